@@ -16,4 +16,7 @@ PLATFORM_START(startAudioSession);
 PLATFORM_STOP(stopAudioSession);
 PLATFORM_CLEANUP(cleanupAudioSession);
 
+// Returns non-zero if the session's backend does not track deadlines
+PLATFORM_STATS(getDriverStats);
+
 } // namespace audio_io
@@ -4,3 +4,5 @@
 #define PLATFORM_START(name) int name(audio_io::hAudioSession sessionPtr)
 #define PLATFORM_STOP(name) int name(audio_io::hAudioSession sessionPtr)
 #define PLATFORM_CLEANUP(name) int name(audio_io::hAudioSession sessionPtr)
+#define PLATFORM_STATS(name)                                                   \
+  int name(audio_io::hAudioSession sessionPtr, audio_io::DriverStats &stats)
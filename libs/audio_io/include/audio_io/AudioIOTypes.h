@@ -13,12 +13,35 @@ enum class BufferFormat {
   Interleaved,    // channels interwoven in single array [LRLRLRLR]
 };
 
+enum class Backend {
+  Platform, // native device (CoreAudio on macOS, else Null)
+  Null,     // no device, callback driven by a dedicated thread
+  FileSink, // same as Null, but output is written to a WAV file
+};
+
 // --- Shared Types ---
 struct Config {
   uint32_t sampleRate = DEFAULT_SAMPLE_RATE;
   uint32_t numFrames = DEFAULT_FRAMES;
   uint16_t numChannels = DEFAULT_CHANNELS;
   BufferFormat bufferFormat = BufferFormat::NonInterleaved;
+
+  Backend backend = Backend::Platform;
+
+  // Null/FileSink only
+  bool realtimePacing = true;       // false = run callbacks back to back
+  const char *outputPath = nullptr; // FileSink only (32-bit float WAV)
+};
+
+// Deadline accounting reported by thread driven backends (Null/FileSink)
+struct DriverStats {
+  uint64_t callbackCount = 0;
+  uint64_t deadlineMisses = 0; // callback took longer than its period
+  uint64_t xruns = 0;          // driver fell behind schedule (paced only)
+  double periodMs = 0.0;       // numFrames / sampleRate
+  double lastCallbackMs = 0.0;
+  double avgCallbackMs = 0.0;
+  double maxCallbackMs = 0.0;
 };
 
 struct AudioBuffer {
@@ -4,6 +4,7 @@ namespace audio_io {
 // --- Shared Types ---
 struct Config;
 struct AudioBuffer;
+struct DriverStats;
 
 struct AudioSession;
 using hAudioSession = AudioSession *;
@@ -1,16 +1,68 @@
 #include "audio_io/AudioIO.h"
-#include "adapters/core_audio/CoreAudioAdapter.h"
+#include "adapters/headless/HeadlessAdapter.h"
 #include "audio_io/AudioIOTypes.h"
+#include "shared/AudioBackend.h"
 #include "shared/AudioSession.h"
 
+#ifdef __APPLE__
+#include "adapters/core_audio/CoreAudioAdapter.h"
+#endif
+
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 
-// TODO(nico): This is where platform choice needs to occur
-
 namespace audio_io {
 
+// ==== Backends ====
+namespace {
+#ifdef __APPLE__
+constexpr AudioBackend CORE_AUDIO_BACKEND{
+    "CoreAudio",
+    CoreAudioAdapter::coreAudioSetup,
+    CoreAudioAdapter::coreAudioStart,
+    CoreAudioAdapter::coreAudioStop,
+    CoreAudioAdapter::coreAudioCleanup,
+    nullptr, // deadlines are owned by the OS
+};
+#endif
+
+constexpr AudioBackend NULL_BACKEND{
+    "Null",
+    HeadlessAdapter::nullSetup,
+    HeadlessAdapter::headlessStart,
+    HeadlessAdapter::headlessStop,
+    HeadlessAdapter::headlessCleanup,
+    HeadlessAdapter::headlessStats,
+};
+
+constexpr AudioBackend FILE_SINK_BACKEND{
+    "FileSink",
+    HeadlessAdapter::fileSinkSetup,
+    HeadlessAdapter::headlessStart,
+    HeadlessAdapter::headlessStop,
+    HeadlessAdapter::headlessCleanup,
+    HeadlessAdapter::headlessStats,
+};
+
+// Platform falls back to the Null backend where there's no native adapter
+const AudioBackend *selectBackend(Backend backend) {
+  switch (backend) {
+  case Backend::Platform:
+#ifdef __APPLE__
+    return &CORE_AUDIO_BACKEND;
+#else
+    return &NULL_BACKEND;
+#endif
+  case Backend::Null:
+    return &NULL_BACKEND;
+  case Backend::FileSink:
+    return &FILE_SINK_BACKEND;
+  }
+  return nullptr;
+}
+} // namespace
+
 hAudioSession setupAudioSession(const Config &userConfig,
                                 AudioCallback userCallback, void *userContext) {
 
@@ -22,10 +74,22 @@ hAudioSession setupAudioSession(const Config &userConfig,
   sessionPtr->userCallback = userCallback;
   sessionPtr->userContext = userContext;
 
-  // Get/Create platform context (CoreAudio for now.  more to come...)
-  int errCode = CoreAudioAdapter::coreAudioSetup(sessionPtr);
+  // Get/Create platform context for the selected backend
+  sessionPtr->backend = selectBackend(userConfig.backend);
+  if (!sessionPtr->backend) {
+    printf("Audio backend not available on this platform\n");
+    delete sessionPtr;
+    return nullptr;
+  }
+
+  if (userConfig.backend == Backend::Platform &&
+      sessionPtr->backend == &NULL_BACKEND)
+    printf("No platform audio backend, using %s (no audio output)\n",
+           NULL_BACKEND.name);
+
+  int errCode = sessionPtr->backend->setup(sessionPtr);
   if (errCode) {
-    printf("Platform setup failed: %d", errCode);
+    printf("%s setup failed: %d", sessionPtr->backend->name, errCode);
     delete sessionPtr;
     return nullptr;
   }
@@ -65,27 +129,27 @@ hAudioSession setupAudioSession(const Config &userConfig,
 }
 
 int startAudioSession(hAudioSession sessionPtr) {
-  int errCode = CoreAudioAdapter::coreAudioStart(sessionPtr);
+  int errCode = sessionPtr->backend->start(sessionPtr);
   if (errCode) {
-    printf("Platform audio start failed: %d", errCode);
+    printf("%s audio start failed: %d", sessionPtr->backend->name, errCode);
     return errCode;
   }
   return 0;
 }
 
 int stopAudioSession(hAudioSession sessionPtr) {
-  int errCode = CoreAudioAdapter::coreAudioStop(sessionPtr);
+  int errCode = sessionPtr->backend->stop(sessionPtr);
   if (errCode) {
-    printf("Platform audio stop failed: %d", errCode);
+    printf("%s audio stop failed: %d", sessionPtr->backend->name, errCode);
     return errCode;
   }
   return 0;
 }
 
 int cleanupAudioSession(hAudioSession sessionPtr) {
-  int errCode = CoreAudioAdapter::coreAudioCleanup(sessionPtr);
+  int errCode = sessionPtr->backend->cleanup(sessionPtr);
   if (errCode) {
-    printf("Platform cleanup failed: %d", errCode);
+    printf("%s cleanup failed: %d", sessionPtr->backend->name, errCode);
     return errCode;
   }
 
@@ -97,4 +161,11 @@ int cleanupAudioSession(hAudioSession sessionPtr) {
   return 0;
 }
 
+int getDriverStats(hAudioSession sessionPtr, DriverStats &stats) {
+  if (!sessionPtr->backend->stats)
+    return 1;
+
+  return sessionPtr->backend->stats(sessionPtr, stats);
+}
+
 } // namespace audio_io
@@ -13,14 +13,18 @@ namespace CoreAudioAdapter {
 // Private to this file - no one else sees this type
 struct CoreAudioContext {
   AudioUnit audioUnit;
+
+  // Channel pointers into ioData, refreshed every callback (zero-copy)
+  float **nativeChannelPtrs;
 };
 
 /* ============ (Core Audio Native Callback) ============
  * This is the function signature required by Core Audio
  * Library and user logic needs to occur in here
  *
- * TODO(nico): Figure out way to pass native buffer if buffer.format
- * matches native.  Avoids copy altogether
+ * The stream is always non-interleaved float32 (see configToASBD), so a
+ * NonInterleaved session renders straight into Core Audio's buffers.
+ * Interleaved sessions render into bufferMemory and get deinterleaved
  */
 static OSStatus
 nativeCallback(void *inRefCon, // ← CoreAudio gives us back what we registered
@@ -30,58 +34,46 @@ nativeCallback(void *inRefCon, // ← CoreAudio gives us back what we registered
 
   auto sessionPtr = static_cast<audio_io::hAudioSession>(inRefCon);
 
-  /* NOTE(nico): ioData->mNumberBuffers value should match the number of buffer
-   * pointers within AudioBuffer. These are determined during config/setup and
-   * SHOULD NOT change.
-   *
-   * Non-Interleaved = mNumberBuffers == number of channelPtrs (aka numChannels)
-   * Interleaved: mNumberBuffers == interleavedPtr (aka 1)
-   */
-
-#ifndef NDEBUG
-  assert(sessionPtr->buffer.numFrames == inNumberFrames);
+  // One buffer per channel whatever the session's bufferFormat (the stream
+  // format is non-interleaved, see configToASBD)
+  assert(ioData->mNumberBuffers == sessionPtr->buffer.numChannels);
 
+  // ==== Zero-copy: Non-Interleaved (src) == Non-Interleaved (dst) ====
   if (sessionPtr->buffer.format == audio_io::BufferFormat::NonInterleaved) {
-    assert(ioData->mNumberBuffers == sessionPtr->buffer.numChannels);
-  } else {
-    assert(ioData->mNumberBuffers == 1);
-  }
-#endif
+    auto *ctx = static_cast<CoreAudioContext *>(sessionPtr->platformContext);
 
-  sessionPtr->userCallback(sessionPtr->buffer, sessionPtr->userContext);
+    for (size_t ch = 0; ch < sessionPtr->buffer.numChannels; ch++) {
+      ctx->nativeChannelPtrs[ch] =
+          static_cast<float *>(ioData->mBuffers[ch].mData);
+      assert(ctx->nativeChannelPtrs[ch]);
+    }
 
-  /* Copy (and convert if required) bufferMemory to Core Audio's buffer
-   * NOTE: _src_ is user configurable but _dst_ is not at this time
-   */
-  if (sessionPtr->buffer.format == audio_io::BufferFormat::NonInterleaved) {
-    // Non-Interleaved (src) -> Non-Interleaved (dst)
-    assert(sessionPtr->buffer.channelPtrs);
+    // Core Audio may ask for fewer frames than configured
+    audio_io::AudioBuffer nativeBuffer = sessionPtr->buffer;
+    nativeBuffer.numFrames = inNumberFrames;
+    nativeBuffer.channelPtrs = ctx->nativeChannelPtrs;
 
-    for (size_t ch = 0; ch < sessionPtr->buffer.numChannels; ch++) {
-      float *dstPtr = static_cast<float *>(ioData->mBuffers[ch].mData);
-      float *srcPtr = sessionPtr->buffer.channelPtrs[ch];
+    sessionPtr->userCallback(nativeBuffer, sessionPtr->userContext);
+    return noErr;
+  }
 
-      assert(dstPtr);
+  // ==== Interleaved (src) -> Non-Interleaved (dst) ====
+  assert(sessionPtr->buffer.numFrames == inNumberFrames);
+  assert(sessionPtr->buffer.interleavedPtr);
 
-      for (size_t i = 0; i < sessionPtr->buffer.numFrames; i++)
-        dstPtr[i] = srcPtr[i];
-    }
-  } else {
-    // Interleaved (src) -> Non-Interleaved (dst)
-    assert(sessionPtr->buffer.interleavedPtr);
+  sessionPtr->userCallback(sessionPtr->buffer, sessionPtr->userContext);
 
-    size_t stride = sessionPtr->buffer.numChannels;
+  size_t stride = sessionPtr->buffer.numChannels;
 
-    for (size_t ch = 0; ch < sessionPtr->buffer.numChannels; ch++) {
-      float *dstPtr = static_cast<float *>(ioData->mBuffers[ch].mData);
-      float *srcPtr = sessionPtr->buffer.interleavedPtr + ch;
+  for (size_t ch = 0; ch < sessionPtr->buffer.numChannels; ch++) {
+    float *dstPtr = static_cast<float *>(ioData->mBuffers[ch].mData);
+    float *srcPtr = sessionPtr->buffer.interleavedPtr + ch;
 
-      assert(dstPtr);
+    assert(dstPtr);
 
-      // Fill channel
-      for (size_t i = 0; i < sessionPtr->buffer.numFrames; i++) {
-        dstPtr[i] = srcPtr[i * stride];
-      }
+    // Fill channel
+    for (size_t i = 0; i < sessionPtr->buffer.numFrames; i++) {
+      dstPtr[i] = srcPtr[i * stride];
     }
   }
 
@@ -171,6 +163,8 @@ int coreAudioSetup(audio_io::hAudioSession sessionPtr) {
   // 4a. Create and set Core Audio context to Handle context
   auto *platformContext = new CoreAudioContext{};
   platformContext->audioUnit = audioUnit;
+  platformContext->nativeChannelPtrs =
+      new float *[sessionPtr->userConfig.numChannels]();
 
   sessionPtr->platformContext = platformContext;
 
@@ -189,6 +183,7 @@ int coreAudioSetup(audio_io::hAudioSession sessionPtr) {
     printf("Error occured with AudioUnitSetProperty: %i\n", callbackPropErr);
     AudioComponentInstanceDispose(audioUnit);
 
+    delete[] platformContext->nativeChannelPtrs;
     delete platformContext;
     sessionPtr->platformContext = nullptr;
     return 4;
@@ -200,6 +195,7 @@ int coreAudioSetup(audio_io::hAudioSession sessionPtr) {
   if (initErr) {
     printf("Failed to initialize AudioUnit: %i\n", initErr);
     AudioComponentInstanceDispose(audioUnit);
+    delete[] platformContext->nativeChannelPtrs;
     delete platformContext;
     sessionPtr->platformContext = nullptr;
     return 5;
@@ -246,6 +242,7 @@ int coreAudioCleanup(audio_io::hAudioSession sessionPtr) {
     return disposeErr;
   }
 
+  delete[] ctx->nativeChannelPtrs;
   delete ctx;
   return 0;
 }
@@ -0,0 +1,273 @@
+#include "HeadlessAdapter.h"
+#include "audio_io/AudioIOTypes.h"
+#include "shared/AudioSession.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+namespace HeadlessAdapter {
+using Clock = std::chrono::steady_clock;
+using Nanoseconds = std::chrono::nanoseconds;
+
+// Private to this file - no one else sees this type
+struct HeadlessContext {
+  std::thread driverThread{};
+  std::atomic<bool> isRunning{false};
+
+  bool isPaced = true;
+  Nanoseconds period{0};
+
+  // ==== FileSink only ====
+  FILE *file = nullptr;
+  float *interleaved = nullptr; // only used if buffer is NonInterleaved
+  uint64_t framesWritten = 0;
+
+  // ==== Deadline accounting (written by driver thread only) ====
+  std::atomic<uint64_t> callbackCount{0};
+  std::atomic<uint64_t> deadlineMisses{0};
+  std::atomic<uint64_t> xruns{0};
+  std::atomic<uint64_t> lastCallbackNs{0};
+  std::atomic<uint64_t> maxCallbackNs{0};
+  std::atomic<uint64_t> totalCallbackNs{0};
+};
+
+// ==== <Internal Helpers> ====
+namespace {
+
+void writeUInt32(FILE *file, uint32_t value) { fwrite(&value, 4, 1, file); }
+void writeUInt16(FILE *file, uint16_t value) { fwrite(&value, 2, 1, file); }
+
+// 32-bit float WAV header. Called with 0 frames on setup and patched
+// with the final size on cleanup
+void writeWavHeader(FILE *file, const audio_io::Config &config,
+                    uint64_t numFrames) {
+  uint32_t blockAlign = config.numChannels * 4u;
+  uint32_t dataSize = static_cast<uint32_t>(numFrames * blockAlign);
+
+  fseek(file, 0, SEEK_SET);
+  fwrite("RIFF", 1, 4, file);
+  writeUInt32(file, 36 + dataSize);
+  fwrite("WAVE", 1, 4, file);
+
+  fwrite("fmt ", 1, 4, file);
+  writeUInt32(file, 16);
+  writeUInt16(file, 3); // IEEE float
+  writeUInt16(file, config.numChannels);
+  writeUInt32(file, config.sampleRate);
+  writeUInt32(file, config.sampleRate * blockAlign);
+  writeUInt16(file, static_cast<uint16_t>(blockAlign));
+  writeUInt16(file, 32);
+
+  fwrite("data", 1, 4, file);
+  writeUInt32(file, dataSize);
+}
+
+void writeBuffer(HeadlessContext *ctx, const audio_io::AudioBuffer &buffer) {
+  size_t numSamples =
+      static_cast<size_t>(buffer.numFrames) * buffer.numChannels;
+
+  if (buffer.format == audio_io::BufferFormat::Interleaved) {
+    fwrite(buffer.interleavedPtr, sizeof(float), numSamples, ctx->file);
+  } else {
+    for (size_t i = 0; i < buffer.numFrames; i++) {
+      for (size_t ch = 0; ch < buffer.numChannels; ch++)
+        ctx->interleaved[i * buffer.numChannels + ch] =
+            buffer.channelPtrs[ch][i];
+    }
+    fwrite(ctx->interleaved, sizeof(float), numSamples, ctx->file);
+  }
+
+  ctx->framesWritten += buffer.numFrames;
+}
+
+void recordCallbackTime(HeadlessContext *ctx, Nanoseconds elapsed) {
+  uint64_t elapsedNs = static_cast<uint64_t>(elapsed.count());
+
+  // Single writer, so relaxed load/store pairs are enough
+  ctx->lastCallbackNs.store(elapsedNs, std::memory_order_relaxed);
+  ctx->totalCallbackNs.store(
+      ctx->totalCallbackNs.load(std::memory_order_relaxed) + elapsedNs,
+      std::memory_order_relaxed);
+
+  if (elapsedNs > ctx->maxCallbackNs.load(std::memory_order_relaxed))
+    ctx->maxCallbackNs.store(elapsedNs, std::memory_order_relaxed);
+
+  if (elapsed > ctx->period)
+    ctx->deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+
+  ctx->callbackCount.fetch_add(1, std::memory_order_release);
+}
+
+/* ============ (Driver Thread) ============
+ * Stand-in for the device's IO thread: calls the user callback once per
+ * period. When paced, sleeps until the next deadline; if a callback (plus
+ * scheduling jitter) overruns the deadline, the schedule is reset to "now"
+ * and an xrun is counted, same as a real device dropping a buffer.
+ */
+void driverLoop(audio_io::hAudioSession sessionPtr) {
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+
+  Clock::time_point nextDeadline = Clock::now() + ctx->period;
+
+  while (ctx->isRunning.load(std::memory_order_acquire)) {
+    Clock::time_point start = Clock::now();
+
+    sessionPtr->userCallback(sessionPtr->buffer, sessionPtr->userContext);
+
+    Clock::time_point end = Clock::now();
+    recordCallbackTime(ctx,
+                       std::chrono::duration_cast<Nanoseconds>(end - start));
+
+    if (ctx->file)
+      writeBuffer(ctx, sessionPtr->buffer);
+
+    if (!ctx->isPaced)
+      continue;
+
+    if (Clock::now() > nextDeadline) {
+      ctx->xruns.fetch_add(1, std::memory_order_relaxed);
+      nextDeadline = Clock::now();
+    } else {
+      std::this_thread::sleep_until(nextDeadline);
+    }
+
+    nextDeadline += ctx->period;
+  }
+}
+
+HeadlessContext *createContext(const audio_io::Config &config) {
+  auto *ctx = new HeadlessContext{};
+  ctx->isPaced = config.realtimePacing;
+  ctx->period = Nanoseconds(static_cast<int64_t>(
+      static_cast<double>(config.numFrames) * 1e9 / config.sampleRate));
+  return ctx;
+}
+
+} // namespace
+// ==== </Internal Helpers> ====
+
+// ============ (Setup) ============
+int nullSetup(audio_io::hAudioSession sessionPtr) {
+  const audio_io::Config &config = sessionPtr->userConfig;
+
+  if (!config.sampleRate || !config.numFrames || !config.numChannels) {
+    printf("Invalid config for null backend\n");
+    return 1;
+  }
+
+  sessionPtr->platformContext = createContext(config);
+  return 0;
+}
+
+int fileSinkSetup(audio_io::hAudioSession sessionPtr) {
+  const audio_io::Config &config = sessionPtr->userConfig;
+
+  if (!config.outputPath) {
+    printf("File sink backend requires Config::outputPath\n");
+    return 1;
+  }
+
+  FILE *file = fopen(config.outputPath, "wb");
+  if (!file) {
+    printf("Unable to open '%s' for file sink\n", config.outputPath);
+    return 2;
+  }
+
+  int errCode = nullSetup(sessionPtr);
+  if (errCode) {
+    fclose(file);
+    return errCode;
+  }
+
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+  ctx->file = file;
+  ctx->interleaved = new float[config.numFrames * config.numChannels];
+
+  writeWavHeader(file, config, 0);
+  return 0;
+}
+
+// ============ (Headless Methods) ============
+int headlessStart(audio_io::hAudioSession sessionPtr) {
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+  if (!ctx) {
+    printf("Unable to [start] AudioSession");
+    return 1;
+  }
+
+  if (ctx->isRunning.load())
+    return 0;
+
+  ctx->isRunning.store(true, std::memory_order_release);
+  ctx->driverThread = std::thread(driverLoop, sessionPtr);
+  return 0;
+}
+
+int headlessStop(audio_io::hAudioSession sessionPtr) {
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+  if (!ctx) {
+    printf("Unable to [stop] AudioSession");
+    return 1;
+  }
+
+  ctx->isRunning.store(false, std::memory_order_release);
+  if (ctx->driverThread.joinable())
+    ctx->driverThread.join();
+
+  return 0;
+}
+
+int headlessCleanup(audio_io::hAudioSession sessionPtr) {
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+  if (!ctx) {
+    printf("Platform context does not exit [cleanup]");
+    return 1;
+  }
+
+  headlessStop(sessionPtr);
+
+  if (ctx->file) {
+    writeWavHeader(ctx->file, sessionPtr->userConfig, ctx->framesWritten);
+    fclose(ctx->file);
+  }
+
+  delete[] ctx->interleaved;
+  delete ctx;
+  sessionPtr->platformContext = nullptr;
+  return 0;
+}
+
+int headlessStats(audio_io::hAudioSession sessionPtr,
+                  audio_io::DriverStats &stats) {
+  auto *ctx = static_cast<HeadlessContext *>(sessionPtr->platformContext);
+  if (!ctx)
+    return 1;
+
+  constexpr double NS_TO_MS = 1e-6;
+
+  stats.callbackCount = ctx->callbackCount.load(std::memory_order_acquire);
+  stats.deadlineMisses = ctx->deadlineMisses.load(std::memory_order_relaxed);
+  stats.xruns = ctx->xruns.load(std::memory_order_relaxed);
+  stats.periodMs = static_cast<double>(ctx->period.count()) * NS_TO_MS;
+  stats.lastCallbackMs = static_cast<double>(ctx->lastCallbackNs.load(
+                             std::memory_order_relaxed)) *
+                         NS_TO_MS;
+  stats.maxCallbackMs = static_cast<double>(ctx->maxCallbackNs.load(
+                            std::memory_order_relaxed)) *
+                        NS_TO_MS;
+
+  uint64_t totalNs = ctx->totalCallbackNs.load(std::memory_order_relaxed);
+  stats.avgCallbackMs =
+      stats.callbackCount
+          ? static_cast<double>(totalNs) * NS_TO_MS /
+                static_cast<double>(stats.callbackCount)
+          : 0.0;
+
+  return 0;
+}
+
+} // namespace HeadlessAdapter
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "audio_io/AudioIOMacros.h"
+#include "audio_io/AudioIOTypesFwd.h"
+
+/* Headless backends (no audio device)
+ * Null:     runs the user callback on a dedicated thread, output discarded
+ * FileSink: same as Null, output appended to a 32-bit float WAV file
+ *
+ * Both pace callbacks in realtime (numFrames / sampleRate) unless
+ * Config::realtimePacing is false, and track per-callback deadlines.
+ */
+namespace HeadlessAdapter {
+
+PLATFORM_SETUP(nullSetup);
+PLATFORM_SETUP(fileSinkSetup);
+
+PLATFORM_START(headlessStart);
+PLATFORM_STOP(headlessStop);
+PLATFORM_CLEANUP(headlessCleanup);
+PLATFORM_STATS(headlessStats);
+
+} // namespace HeadlessAdapter
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "audio_io/AudioIOMacros.h"
+#include "audio_io/AudioIOTypesFwd.h"
+
+namespace audio_io {
+/* Backend interface: every adapter provides the same set of entry points.
+ * Selected once in setupAudioSession() based on Config::backend.
+ * _stats_ is optional (nullptr if the backend can't report deadlines).
+ */
+struct AudioBackend {
+  const char *name;
+
+  PLATFORM_SETUP((*setup));
+  PLATFORM_START((*start));
+  PLATFORM_STOP((*stop));
+  PLATFORM_CLEANUP((*cleanup));
+  PLATFORM_STATS((*stats));
+};
+
+} // namespace audio_io
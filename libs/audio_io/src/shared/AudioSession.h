@@ -1,17 +1,20 @@
 #include "audio_io/AudioIO.h"
 #include "audio_io/AudioIOTypes.h"
 
+#include "AudioBackend.h"
+
 namespace audio_io {
 struct AudioSession {
-  float *bufferMemory; // Actual memory buffer
-  AudioBuffer buffer;  // user facing with pointers to bufferMemory
+  float *bufferMemory = nullptr; // Actual memory buffer
+  AudioBuffer buffer{}; // user facing with pointers to bufferMemory
 
-  Config userConfig;
+  Config userConfig{};
 
-  AudioCallback userCallback;
-  void *userContext;
+  AudioCallback userCallback = nullptr;
+  void *userContext = nullptr;
 
-  void *platformContext;
+  const AudioBackend *backend = nullptr;
+  void *platformContext = nullptr;
 
   bool isValid() const {
     return bufferMemory != nullptr && platformContext != nullptr;
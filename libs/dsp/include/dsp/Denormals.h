@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+/* ==== Denormal handling ====
+ * Filter and envelope state decays toward 0 after a release; once it's
+ * below FLT_MIN (~1e-38) x86 runs every operation on it through microcode
+ * (10-100x slower). Flush-to-zero (FTZ: denormal results become 0) and
+ * denormals-are-zero (DAZ, x86 only: denormal inputs read as 0) avoid it.
+ * Both are per-thread control bits, so every thread that renders sets them.
+ */
+namespace dsp::denormals {
+// Saved FP control register (MXCSR on x86, FPCR on arm64)
+using FPState = uint64_t;
+
+// Smallest normal float: states below it are flushed by the guards
+inline constexpr float MIN_NORMAL = 1.17549435e-38f;
+
+// Enable FTZ (and DAZ) on the calling thread; returns the previous state
+FPState enableFlushToZero();
+void restoreFPState(FPState state);
+
+// False on targets without FTZ control
+bool isFlushToZeroEnabled();
+
+// Guard for state carried across blocks: 0 below MIN_NORMAL. Works
+// without FTZ too (threads that didn't set it, targets without it)
+inline float flushDenormal(float x) {
+  return (x < MIN_NORMAL && x > -MIN_NORMAL) ? 0.0f : x;
+}
+
+// Scoped FTZ/DAZ for a render (restored on exit)
+struct ScopedFlushToZero {
+  FPState savedState = enableFlushToZero();
+
+  ScopedFlushToZero() = default;
+  ScopedFlushToZero(const ScopedFlushToZero &) = delete;
+  ScopedFlushToZero &operator=(const ScopedFlushToZero &) = delete;
+  ~ScopedFlushToZero() { restoreFPState(savedState); }
+};
+
+} // namespace dsp::denormals
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace dsp::envelopes {
 
 enum class Status { Idle, Attack, Decay, Sustain, Release };
@@ -8,4 +10,21 @@ float processADSR(Status &state, float &amplitude, float &progress,
                   float &releaseStartLevel, float attackInc, float decayInc,
                   float releaseInc, float sustainLevel);
 
+/* Block version: writes numSamples envelope levels into _output_.
+ * Segment based: each stage's run is a closed-form ramp (progress =
+ * start + k * increment) or a constant fill, with transitions only between
+ * runs. Matches processADSR up to float rounding (no per-sample
+ * accumulation, so long stages land slightly more exactly)
+ */
+void processADSRBlock(Status &state, float &amplitude, float &progress,
+                      float &releaseStartLevel, float attackInc,
+                      float decayInc, float releaseInc, float sustainLevel,
+                      float *output, size_t numSamples);
+
+// Advances numSamples like processADSRBlock without writing the levels;
+// returns the level after the last one
+float advanceADSR(Status &state, float &amplitude, float &progress,
+                  float &releaseStartLevel, float attackInc, float decayInc,
+                  float releaseInc, float sustainLevel, size_t numSamples);
+
 } // namespace dsp::envelopes
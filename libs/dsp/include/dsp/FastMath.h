@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Math.h"
+
+#include <cstdint>
+
+/* ==== Fast sin / tan / tanh ====
+ * Branch-free polynomial/rational approximations: inline so loops over them
+ * auto-vectorize (std::sin/tan/tanh are library calls, which only
+ * vectorize where a vector math library is available).
+ *
+ * Accuracy tiers (max error over the domain, checked by tools/math_bench):
+ *
+ *              sinPi (abs)   tanPi (rel)   tanh (abs)
+ *   Fast         1.4e-4        6.5e-4        2.7e-3
+ *   Balanced     1.3e-6        4.6e-5        7.5e-5
+ *   Precise      2.0e-7        4.0e-7        2.3e-6
+ *
+ * The tier used by the engine is picked per build with
+ * DSP_MATH_ACCURACY (0 = Fast, 1 = Balanced, 2 = Precise; Makefile
+ * MATH_ACCURACY). Call sites can still ask for a specific tier.
+ */
+#ifndef DSP_MATH_ACCURACY
+#define DSP_MATH_ACCURACY 1
+#endif
+
+namespace dsp::math {
+enum class Accuracy { Fast, Balanced, Precise };
+
+inline constexpr Accuracy DEFAULT_ACCURACY =
+    static_cast<Accuracy>(DSP_MATH_ACCURACY);
+
+inline constexpr float INV_PI_F = 1.0f / PI_F;
+
+/* sin and tan take their argument in half turns (x = 1 -> π radians):
+ * cutoff / sampleRate for the filters, 2 * phase for oscillators. Range
+ * reduction is then exact in float (no π rounding error to lose, and
+ * nothing -ffast-math can reassociate away)
+ */
+
+// sin(π·x), any x
+template <Accuracy A = DEFAULT_ACCURACY> inline float fastSinPi(float x) {
+  // Reduce to [-1, 1], then fold into [-0.5, 0.5] (sin(π - a) = sin(a))
+  float half = x * 0.5f;
+  float nearest = static_cast<float>(
+      static_cast<int32_t>(half + (half >= 0.0f ? 0.5f : -0.5f)));
+  float r = x - 2.0f * nearest;
+
+  r = r > 0.5f ? 1.0f - r : r;
+  r = r < -0.5f ? -1.0f - r : r;
+
+  // r * P(r²), Chebyshev-fitted on [-0.5, 0.5]
+  float r2 = r * r;
+  if constexpr (A == Accuracy::Fast) {
+    return r * (3.14131474f + r2 * (-5.14766216f + r2 * 2.3339088f));
+  } else if constexpr (A == Accuracy::Balanced) {
+    return r * (3.14159036f +
+                r2 * (-5.16740561f + r2 * (2.54400015f + r2 * -0.55943501f)));
+  } else {
+    return r * (3.14159274f +
+                r2 * (-5.1677103f +
+                      r2 * (2.55007744f +
+                            r2 * (-0.598290384f + r2 * 0.0776559114f))));
+  }
+}
+
+// tan(π·x) for |x| < 0.5 (the SVF pre-warp is tan(π · cutoff / rate))
+template <Accuracy A = DEFAULT_ACCURACY> inline float fastTanPi(float x) {
+  // Fold (0.25, 0.5) onto (0, 0.25) with tan(π·a) = 1 / tan(π·(0.5 - a))
+  float a = x < 0.0f ? -x : x;
+  bool isFolded = a > 0.25f;
+  float y = isFolded ? 0.5f - a : a;
+
+  // y * Q(y²), Chebyshev-fitted on [0, 0.25]
+  float y2 = y * y;
+  float t;
+  if constexpr (A == Accuracy::Fast) {
+    t = y * (3.14347768f + y2 * (9.80006027f + y2 * 61.8253021f));
+  } else if constexpr (A == Accuracy::Balanced) {
+    t = y * (3.14145732f +
+             y2 * (10.4041729f + y2 * (35.5344925f + y2 * 283.831482f)));
+  } else {
+    t = y * (3.14159203f +
+             y2 * (10.3362265f +
+                   y2 * (40.6558189f +
+                         y2 * (172.653381f +
+                               y2 * (374.526245f + y2 * 5992.24805f)))));
+  }
+
+  float r = isFolded ? 1.0f / t : t;
+  return x < 0.0f ? -r : r;
+}
+
+// Radian versions (one extra multiply; the half-turn forms are more
+// accurate near tan's pole)
+template <Accuracy A = DEFAULT_ACCURACY> inline float fastSin(float x) {
+  return fastSinPi<A>(x * INV_PI_F);
+}
+
+template <Accuracy A = DEFAULT_ACCURACY> inline float fastTan(float x) {
+  return fastTanPi<A>(x * INV_PI_F);
+}
+
+// tanh(x), any x (input clamped where the fit reaches ±1)
+template <Accuracy A = DEFAULT_ACCURACY> inline float fastTanh(float x) {
+  // x * P(x²) / Q(x²), least-squares fitted up to the clamp
+  if constexpr (A == Accuracy::Fast) {
+    x = x > 3.0f ? 3.0f : (x < -3.0f ? -3.0f : x);
+    float x2 = x * x;
+    return x * (0.998318911f + x2 * 0.0495547429f) /
+           (1.0f + x2 * 0.371603489f);
+  } else if constexpr (A == Accuracy::Balanced) {
+    x = x > 5.0f ? 5.0f : (x < -5.0f ? -5.0f : x);
+    float x2 = x * x;
+    return x * (0.99995172f + x2 * (0.101556703f + x2 * 0.000647324952f)) /
+           (1.0f + x2 * (0.434464216f + x2 * 0.0125709837f));
+  } else {
+    x = x > 6.8f ? 6.8f : (x < -6.8f ? -6.8f : x);
+    float x2 = x * x;
+    float p =
+        0.999998689f +
+        x2 * (0.122785479f + x2 * (0.00225672335f + x2 * 3.84600389e-06f));
+    float q = 1.0f +
+              x2 * (0.456105202f + x2 * (0.020974597f + x2 * 0.000140267512f));
+    return x * p / q;
+  }
+}
+
+} // namespace dsp::math
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace dsp::filters {
 struct SVFOutputs {
   float lp, bp, hp;
@@ -28,11 +30,26 @@ struct SVFState {
 struct SVFCoeffs {
   float a1, a2, a3;
   float k; // damping = 1/Q
+  float g; // pre-warped frequency (kept for interpolation)
 };
 
 SVFCoeffs computeSVFCoeffs(float cutoff, float Q, float invSampleRate);
+
+// a1..a3 from pre-warped frequency _g_ and damping _k_ (no tan)
+SVFCoeffs computeSVFCoeffs(float g, float k);
 SVFOutputs processSVF(float input, const SVFCoeffs &c, SVFState &s);
 
+// Block version (in place): buffer[i] = lp * lpGain + bp * bpGain + hp * hpGain
+// e.g. LP = {1, 0, 0}, Notch = {1, 0, 1}
+void processSVFBlock(float *buffer, size_t numSamples, const SVFCoeffs &c,
+                     SVFState &s, float lpGain, float bpGain, float hpGain);
+
+// Same, with g and k ramped linearly from _from_ (exclusive) to _to_
+// (reached on the last sample)
+void processSVFBlock(float *buffer, size_t numSamples, const SVFCoeffs &from,
+                     const SVFCoeffs &to, SVFState &s, float lpGain,
+                     float bpGain, float hpGain);
+
 // ==== Ladder Filter (Moog style) ====
 struct LadderState {
   float s[4] = {0, 0, 0, 0};
@@ -41,4 +58,21 @@ struct LadderState {
 float processLadder(float input, float f, float resonance, LadderState &st);
 float processLadderNonlinear(float input, float f, float resonance, float drive,
                              LadderState &st);
+
+// Block versions (in place)
+void processLadderBlock(float *buffer, size_t numSamples, float f,
+                        float resonance, LadderState &st);
+void processLadderNonlinearBlock(float *buffer, size_t numSamples, float f,
+                                 float resonance, float drive,
+                                 LadderState &st);
+
+// Block versions with f and resonance ramped linearly from the _from_
+// values (exclusive) to the _to_ values (reached on the last sample)
+void processLadderBlock(float *buffer, size_t numSamples, float fromF,
+                        float toF, float fromResonance, float toResonance,
+                        LadderState &st);
+void processLadderNonlinearBlock(float *buffer, size_t numSamples,
+                                 float fromF, float toF, float fromResonance,
+                                 float toResonance, float drive,
+                                 LadderState &st);
 } // namespace dsp::filters
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace dsp::math {
 inline constexpr float PI_F = 3.1415927f;
 inline constexpr double PI_DOUBLE = 3.141592653589793;
@@ -13,4 +15,8 @@ inline constexpr float SEMITONE_RATIO = 1.059463094f;
 float fastExp2(float x);
 float semitonesToFreqRatio(float x);
 
+// Block version: ratios[i] = semitonesToFreqRatio(startSemitones + step * i)
+void semitonesToFreqRatios(float startSemitones, float stepSemitones,
+                           float *ratios, size_t numSamples);
+
 } // namespace dsp::math
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/* ==== Counter-based noise ====
+ * Sample n of a stream is hash(key, n): no state is carried from one
+ * sample to the next, so a block (or a group of voices across SIMD lanes)
+ * is one independent loop, and any stream replays exactly from its key.
+ * Inline so loops over it auto-vectorize (32-bit multiplies and shifts).
+ *
+ * Pink is white through Paul Kellet's 3-pole "economy" filter (+/-0.5 dB
+ * above 30 Hz at 44.1 kHz); its filter state is per stream.
+ */
+namespace dsp::noise {
+inline constexpr uint32_t WEYL_STEP = 0x9E3779B9u; // 2^32 / golden ratio
+inline constexpr float INV_2_POW_31 = 1.0f / 2147483648.0f;
+
+// Pink output scale (roughly unit peak)
+inline constexpr float PINK_GAIN = 0.25f;
+
+struct PinkState {
+  float b0 = 0.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+};
+
+// 32-bit integer hash (lowbias32, C. Wellons)
+inline uint32_t hash(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7FEB352Du;
+  x ^= x >> 15;
+  x *= 0x846CA68Bu;
+  x ^= x >> 16;
+  return x;
+}
+
+// Sample _counter_ of the stream _key_, uniform in [-1.0, 1.0)
+inline float white(uint32_t key, uint32_t counter) {
+  uint32_t bits = hash(key + counter * WEYL_STEP);
+  return static_cast<float>(static_cast<int32_t>(bits)) * INV_2_POW_31;
+}
+
+inline float pink(float &b0, float &b1, float &b2, float white) {
+  b0 = 0.99765f * b0 + white * 0.0990460f;
+  b1 = 0.96300f * b1 + white * 0.2965164f;
+  b2 = 0.57000f * b2 + white * 1.0526913f;
+  return (b0 + b1 + b2 + white * 0.1848f) * PINK_GAIN;
+}
+
+// Key for stream _index_ of _seed_ (e.g. one per note)
+inline uint32_t streamKey(uint32_t seed, uint32_t index) {
+  return hash(seed ^ hash(index + WEYL_STEP));
+}
+
+// Block versions: write samples _counter_ .. _counter_ + numSamples - 1
+void whiteBlock(uint32_t key, uint32_t counter, float *output,
+                size_t numSamples);
+void pinkBlock(uint32_t key, uint32_t counter, PinkState &state,
+               float *output, size_t numSamples);
+
+} // namespace dsp::noise
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/* ==== Numerical health ====
+ * Samples are classified from their bit patterns (exponent and mantissa
+ * fields): -ffast-math may fold std::isnan/isinf to false, and integer
+ * compares make the scan a branch-free loop that vectorizes.
+ */
+namespace dsp::health {
+struct BlockHealth {
+  uint32_t nans = 0;
+  uint32_t infs = 0;
+  uint32_t denormals = 0;
+  uint32_t clipped = 0; // finite and |x| > clip level
+};
+
+BlockHealth scanBlock(const float *buffer, size_t numSamples,
+                      float clipLevel);
+
+} // namespace dsp::health
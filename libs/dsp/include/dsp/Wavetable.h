@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Waveforms.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/* ==== Mip-mapped band-limited wavetables ====
+ * One table per octave: level k holds harmonics up to
+ * (TABLE_SIZE / 2) >> k, so any phase increment maps to the lowest level
+ * whose top harmonic stays under Nyquist. Playback is a single linearly
+ * interpolated lookup per sample (no std::sin, no PolyBLEP branches).
+ */
+namespace dsp::wavetable {
+inline constexpr uint32_t TABLE_SIZE = 2048; // samples per cycle
+inline constexpr uint32_t NUM_LEVELS = 11;   // 1024 harmonics down to 1
+inline constexpr uint32_t MAX_HARMONICS = TABLE_SIZE / 2;
+
+// 2 guard samples so [i + 1] never needs a wrap (even for phase ~1.0)
+inline constexpr uint32_t ROW_SIZE = TABLE_SIZE + 2;
+
+struct Wavetable {
+  float samples[NUM_LEVELS][ROW_SIZE];
+};
+
+// Build every level from sine/cosine harmonic amplitudes (index 0 = 1st
+// harmonic). Harmonics past MAX_HARMONICS are ignored
+void buildFromHarmonics(Wavetable &table, const float *sinAmps,
+                        const float *cosAmps, size_t numHarmonics);
+
+// Built-in Sine/Saw/Square/Triangle (same shape and level as the
+// dsp::waveforms versions). Built once; call from setup code
+void initBuiltinTables();
+const Wavetable &getBuiltinTable(waveforms::WaveformType type);
+
+// Lowest level whose top harmonic is below Nyquist for _phaseIncrement_
+inline uint32_t mipLevel(float phaseIncrement) {
+  // ceil(log2(phaseIncrement * TABLE_SIZE)) from the float's bits
+  float x = phaseIncrement * static_cast<float>(TABLE_SIZE);
+
+  uint32_t bits;
+  std::memcpy(&bits, &x, 4);
+
+  int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127;
+  int32_t level = exponent + ((bits & 0x7FFFFF) ? 1 : 0);
+
+  level = level < 0 ? 0 : level;
+  level = level > static_cast<int32_t>(NUM_LEVELS - 1)
+              ? static_cast<int32_t>(NUM_LEVELS - 1)
+              : level;
+  return static_cast<uint32_t>(level);
+}
+
+// _phase_ in [0, 1)
+inline float lookup(const Wavetable &table, float phase,
+                    float phaseIncrement) {
+  const float *row = table.samples[mipLevel(phaseIncrement)];
+
+  float position = phase * static_cast<float>(TABLE_SIZE);
+  int32_t index = static_cast<int32_t>(position);
+  float frac = position - static_cast<float>(index);
+
+  return row[index] + frac * (row[index + 1] - row[index]);
+}
+
+// Block version: ADDS table * gain into _output_ and advances _phase_
+// by phaseIncrements[i] each sample. Mip level is picked once per block
+// from the highest increment (pitch mod can't push it past Nyquist)
+void processWavetableBlock(const Wavetable &table, float &phase,
+                           const float *phaseIncrements, float gain,
+                           float *output, size_t numSamples);
+
+} // namespace dsp::wavetable
@@ -0,0 +1,62 @@
+#include "dsp/Denormals.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>
+#endif
+
+namespace dsp::denormals {
+
+// ==== <Internal Helpers> ====
+namespace {
+#if defined(__x86_64__) || defined(__i386__)
+constexpr uint32_t MXCSR_DAZ = 1u << 6;
+constexpr uint32_t MXCSR_FTZ = 1u << 15;
+constexpr uint32_t FLUSH_BITS = MXCSR_DAZ | MXCSR_FTZ;
+
+FPState readFPState() { return _mm_getcsr(); }
+
+void writeFPState(FPState state) {
+  _mm_setcsr(static_cast<uint32_t>(state));
+}
+#elif defined(__aarch64__)
+constexpr uint64_t FPCR_FZ = uint64_t{1} << 24;
+constexpr uint64_t FLUSH_BITS = FPCR_FZ;
+
+FPState readFPState() {
+  uint64_t fpcr;
+  asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+  return fpcr;
+}
+
+void writeFPState(FPState state) { asm volatile("msr fpcr, %0" ::"r"(state)); }
+#else
+constexpr uint64_t FLUSH_BITS = 0;
+
+FPState readFPState() { return 0; }
+void writeFPState(FPState) {}
+#endif
+} // namespace
+// ==== </Internal Helpers> ====
+
+FPState enableFlushToZero() {
+  FPState state = readFPState();
+
+  // Writing the control register can stall the pipeline, skip if set
+  if ((state & FLUSH_BITS) != FLUSH_BITS)
+    writeFPState(state | FLUSH_BITS);
+
+  return state;
+}
+
+void restoreFPState(FPState state) {
+  if (readFPState() != state)
+    writeFPState(state);
+}
+
+bool isFlushToZeroEnabled() {
+  return FLUSH_BITS != 0 && (readFPState() & FLUSH_BITS) == FLUSH_BITS;
+}
+
+} // namespace dsp::denormals
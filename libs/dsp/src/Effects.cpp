@@ -1,4 +1,5 @@
 #include "dsp/Effects.h"
+#include "dsp/FastMath.h"
 
 #include <algorithm>
 #include <cassert>
@@ -22,7 +23,7 @@ float softClip(float sample, float drive, float invDrive, float mix) {
   assert(drive >= 0.0f);
   assert(drive <= 5.0f);
 
-  float saturated = std::tanh(sample * drive) * invDrive;
+  float saturated = math::fastTanh(sample * drive) * invDrive;
   return sample * (1.0f - mix) + (saturated * mix);
 }
 
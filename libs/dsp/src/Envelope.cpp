@@ -1,5 +1,8 @@
 #include "dsp/Envelope.h"
 
+#include <cmath>
+#include <cstddef>
+
 namespace dsp::envelopes {
 
 float processADSR(Status &state, float &amplitude, float &progress,
@@ -48,4 +51,158 @@ float processADSR(Status &state, float &amplitude, float &progress,
 
   return amplitude;
 };
+
+// ==== <Segment Helpers> ====
+namespace {
+// Stage progress _k_ samples into a segment. Closed form (one rounding)
+// so a run is an independent loop; same expression for runs and bounds
+inline float stageProgress(float progress, float increment, size_t k) {
+  return progress + static_cast<float>(k) * increment;
+}
+
+// Samples k = 1, 2, ... of the ramp that stay below 1.0 (capped at
+// _maxSamples_); sample run + 1 is the stage transition
+size_t rampRun(float progress, float increment, size_t maxSamples) {
+  float estimate = std::ceil((1.0f - progress) / increment) - 1.0f;
+  size_t run = !(estimate > 0.0f) ? 0
+               : estimate >= static_cast<float>(maxSamples)
+                   ? maxSamples
+                   : static_cast<size_t>(estimate);
+
+  // The estimate can be off by one either way: settle on the exact edge
+  while (run < maxSamples &&
+         stageProgress(progress, increment, run + 1) < 1.0f)
+    run++;
+  while (run > 0 && stageProgress(progress, increment, run) >= 1.0f)
+    run--;
+
+  return run;
+}
+
+// Level after a run: the last one written, so the state continues from
+// exactly what was output
+template <bool OUTPUT>
+inline float lastLevel(const float *output, size_t end, float level) {
+  if constexpr (OUTPUT)
+    return output[end - 1];
+  return level;
+}
+
+/* Same stages as processADSR, one segment at a time: the length of the
+ * current stage's run is computed up front, the run is a branch-free fill
+ * and transitions happen only between runs. Without OUTPUT only the state
+ * advances (e.g. a block-rate mod source that needs the end level).
+ */
+template <bool OUTPUT>
+void runADSR(Status &state, float &amplitude, float &progress,
+             float releaseStartLevel, float attackInc, float decayInc,
+             float releaseInc, float sustainLevel, float *output,
+             size_t numSamples) {
+  size_t i = 0;
+
+  while (i < numSamples) {
+    size_t remaining = numSamples - i;
+
+    switch (state) {
+    case Status::Attack: {
+      size_t run = rampRun(progress, attackInc, remaining);
+      if constexpr (OUTPUT) {
+        for (size_t k = 0; k < run; k++)
+          output[i + k] = stageProgress(progress, attackInc, k + 1);
+      }
+      progress = stageProgress(progress, attackInc, run);
+      if (run)
+        amplitude = lastLevel<OUTPUT>(output, i + run, progress);
+      i += run;
+
+      if (i < numSamples) {
+        state = Status::Decay;
+        progress = 0.0f;
+        amplitude = 1.0f;
+        if constexpr (OUTPUT)
+          output[i] = amplitude;
+        i++;
+      }
+      break;
+    }
+
+    case Status::Decay: {
+      const float depth = 1.0f - sustainLevel;
+      size_t run = rampRun(progress, decayInc, remaining);
+      if constexpr (OUTPUT) {
+        for (size_t k = 0; k < run; k++)
+          output[i + k] =
+              1.0f - stageProgress(progress, decayInc, k + 1) * depth;
+      }
+      progress = stageProgress(progress, decayInc, run);
+      if (run)
+        amplitude = lastLevel<OUTPUT>(output, i + run, 1.0f - progress * depth);
+      i += run;
+
+      if (i < numSamples) {
+        state = Status::Sustain;
+        progress += decayInc;
+        amplitude = sustainLevel;
+        if constexpr (OUTPUT)
+          output[i] = amplitude;
+        i++;
+      }
+      break;
+    }
+
+    case Status::Release: {
+      size_t run = rampRun(progress, releaseInc, remaining);
+      if constexpr (OUTPUT) {
+        for (size_t k = 0; k < run; k++)
+          output[i + k] = releaseStartLevel *
+                          (1.0f - stageProgress(progress, releaseInc, k + 1));
+      }
+      progress = stageProgress(progress, releaseInc, run);
+      if (run)
+        amplitude = lastLevel<OUTPUT>(output, i + run,
+                                      releaseStartLevel * (1.0f - progress));
+      i += run;
+
+      if (i < numSamples) {
+        state = Status::Idle;
+        progress += releaseInc;
+        amplitude = 0.0f;
+        if constexpr (OUTPUT)
+          output[i] = amplitude;
+        i++;
+      }
+      break;
+    }
+
+    // Constant to the end of the block
+    case Status::Sustain:
+    case Status::Idle:
+      amplitude = state == Status::Sustain ? sustainLevel : 0.0f;
+      if constexpr (OUTPUT) {
+        for (size_t k = 0; k < remaining; k++)
+          output[i + k] = amplitude;
+      }
+      i = numSamples;
+      break;
+    }
+  }
+}
+} // namespace
+// ==== </Segment Helpers> ====
+
+void processADSRBlock(Status &state, float &amplitude, float &progress,
+                      float &releaseStartLevel, float attackInc,
+                      float decayInc, float releaseInc, float sustainLevel,
+                      float *output, size_t numSamples) {
+  runADSR<true>(state, amplitude, progress, releaseStartLevel, attackInc,
+                decayInc, releaseInc, sustainLevel, output, numSamples);
+}
+
+float advanceADSR(Status &state, float &amplitude, float &progress,
+                  float &releaseStartLevel, float attackInc, float decayInc,
+                  float releaseInc, float sustainLevel, size_t numSamples) {
+  runADSR<false>(state, amplitude, progress, releaseStartLevel, attackInc,
+                 decayInc, releaseInc, sustainLevel, nullptr, numSamples);
+  return amplitude;
+}
 } // namespace dsp::envelopes
@@ -1,8 +1,11 @@
 #include "dsp/Filters.h"
+#include "dsp/Denormals.h"
+#include "dsp/FastMath.h"
 #include "dsp/Math.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 namespace dsp::filters {
 
@@ -15,7 +18,7 @@ void updateFilterCoefficients(float &f, float &q, float cutoff, float resonance,
   resonance = std::clamp(resonance, 0.0f, 0.99f);
 
   // Calculate filter coefficients
-  f = 2.0f * std::sin(math::PI_F * cutoff / sampleRate);
+  f = 2.0f * math::fastSinPi(cutoff / sampleRate);
   q = 1.0f - resonance;
 }
 
@@ -36,16 +39,15 @@ float getBandpass(const SVFOutputs &state) { return state.bp; }
 
 // Call when cutoff or resonance changes — NOT per sample
 SVFCoeffs computeSVFCoeffs(float cutoff, float Q, float invSampleRate) {
-  /* TODO(nico): optimize this
-   * - std::tan() polynomial approximation?
-   */
-  float g =
-      std::tan(math::PI_F * cutoff * invSampleRate); // pre-warped frequency
-  float k = 1.0f / Q;
+  float g = math::fastTanPi(cutoff * invSampleRate); // pre-warped frequency
+  return computeSVFCoeffs(g, 1.0f / Q);
+}
+
+SVFCoeffs computeSVFCoeffs(float g, float k) {
   float a1 = 1.0f / (1.0f + g * (g + k));
   float a2 = g * a1;
   float a3 = g * a2;
-  return {a1, a2, a3, k};
+  return {a1, a2, a3, k, g};
 }
 
 SVFOutputs processSVF(float input, const SVFCoeffs &c, SVFState &s) {
@@ -77,10 +79,10 @@ float processLadder(float input, float f, float resonance, LadderState &st) {
 float processLadderNonlinear(float input, float f, float resonance, float drive,
                              LadderState &st) {
   // Nonlinear feedback — tanh prevents harsh blowup at high resonance
-  float feedback = resonance * std::tanh(st.s[3]);
+  float feedback = resonance * math::fastTanh(st.s[3]);
 
   // Drive into the input — saturates before the filter stages
-  float x = std::tanh(drive * input - feedback);
+  float x = math::fastTanh(drive * input - feedback);
 
   st.s[0] += f * (x - st.s[0]);
   st.s[1] += f * (st.s[0] - st.s[1]);
@@ -89,4 +91,121 @@ float processLadderNonlinear(float input, float f, float resonance, float drive,
 
   return st.s[3];
 }
+
+// ==== Block Versions ====
+// State is copied into locals so it stays in registers for the whole block,
+// and flushed once on the way out (a decaying tail goes to exactly 0
+// instead of denormals)
+
+// ==== <Denormal Guards> ====
+namespace {
+void flushDenormals(SVFState &s) {
+  s.ic1 = denormals::flushDenormal(s.ic1);
+  s.ic2 = denormals::flushDenormal(s.ic2);
+}
+
+void flushDenormals(LadderState &st) {
+  for (float &s : st.s)
+    s = denormals::flushDenormal(s);
+}
+} // namespace
+// ==== </Denormal Guards> ====
+
+void processSVFBlock(float *buffer, size_t numSamples, const SVFCoeffs &c,
+                     SVFState &s, float lpGain, float bpGain, float hpGain) {
+  SVFState state = s;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    SVFOutputs out = processSVF(buffer[i], c, state);
+    buffer[i] = out.lp * lpGain + out.bp * bpGain + out.hp * hpGain;
+  }
+
+  flushDenormals(state);
+  s = state;
+}
+
+void processSVFBlock(float *buffer, size_t numSamples, const SVFCoeffs &from,
+                     const SVFCoeffs &to, SVFState &s, float lpGain,
+                     float bpGain, float hpGain) {
+  SVFState state = s;
+
+  float invNumSamples = 1.0f / static_cast<float>(numSamples);
+  float gStep = (to.g - from.g) * invNumSamples;
+  float kStep = (to.k - from.k) * invNumSamples;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    float ramp = static_cast<float>(i + 1);
+    SVFCoeffs c =
+        computeSVFCoeffs(from.g + gStep * ramp, from.k + kStep * ramp);
+
+    SVFOutputs out = processSVF(buffer[i], c, state);
+    buffer[i] = out.lp * lpGain + out.bp * bpGain + out.hp * hpGain;
+  }
+
+  flushDenormals(state);
+  s = state;
+}
+
+void processLadderBlock(float *buffer, size_t numSamples, float f,
+                        float resonance, LadderState &st) {
+  LadderState state = st;
+
+  for (size_t i = 0; i < numSamples; i++)
+    buffer[i] = processLadder(buffer[i], f, resonance, state);
+
+  flushDenormals(state);
+  st = state;
+}
+
+void processLadderNonlinearBlock(float *buffer, size_t numSamples, float f,
+                                 float resonance, float drive,
+                                 LadderState &st) {
+  LadderState state = st;
+
+  for (size_t i = 0; i < numSamples; i++)
+    buffer[i] = processLadderNonlinear(buffer[i], f, resonance, drive, state);
+
+  flushDenormals(state);
+  st = state;
+}
+
+void processLadderBlock(float *buffer, size_t numSamples, float fromF,
+                        float toF, float fromResonance, float toResonance,
+                        LadderState &st) {
+  LadderState state = st;
+
+  float invNumSamples = 1.0f / static_cast<float>(numSamples);
+  float fStep = (toF - fromF) * invNumSamples;
+  float resStep = (toResonance - fromResonance) * invNumSamples;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    float ramp = static_cast<float>(i + 1);
+    buffer[i] = processLadder(buffer[i], fromF + fStep * ramp,
+                              fromResonance + resStep * ramp, state);
+  }
+
+  flushDenormals(state);
+  st = state;
+}
+
+void processLadderNonlinearBlock(float *buffer, size_t numSamples,
+                                 float fromF, float toF, float fromResonance,
+                                 float toResonance, float drive,
+                                 LadderState &st) {
+  LadderState state = st;
+
+  float invNumSamples = 1.0f / static_cast<float>(numSamples);
+  float fStep = (toF - fromF) * invNumSamples;
+  float resStep = (toResonance - fromResonance) * invNumSamples;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    float ramp = static_cast<float>(i + 1);
+    buffer[i] = processLadderNonlinear(buffer[i], fromF + fStep * ramp,
+                                       fromResonance + resStep * ramp, drive,
+                                       state);
+  }
+
+  flushDenormals(state);
+  st = state;
+}
 } // namespace dsp::filters
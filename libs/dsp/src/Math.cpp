@@ -1,5 +1,6 @@
 #include "dsp/Math.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -23,4 +24,11 @@ float fastExp2(float x) {
 
 float semitonesToFreqRatio(float x) { return fastExp2(x / 12); }
 
+void semitonesToFreqRatios(float startSemitones, float stepSemitones,
+                           float *ratios, size_t numSamples) {
+  for (size_t i = 0; i < numSamples; i++)
+    ratios[i] = semitonesToFreqRatio(startSemitones +
+                                     stepSemitones * static_cast<float>(i));
+}
+
 } // namespace dsp::math
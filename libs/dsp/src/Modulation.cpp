@@ -17,6 +17,7 @@ float processLFO(float phase, waveforms::WaveformType type, float pulseWidth) {
   case waveforms::WaveformType::Triangle:
     return waveforms::triangle(phase);
   }
+  return 0.0f; // unreachable, every type is handled above
 }
 
 // TODO(nico): spend more time understanding these...
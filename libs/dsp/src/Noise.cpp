@@ -0,0 +1,31 @@
+#include "dsp/Noise.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dsp::noise {
+
+void whiteBlock(uint32_t key, uint32_t counter, float *output,
+                size_t numSamples) {
+  for (size_t i = 0; i < numSamples; i++)
+    output[i] = white(key, counter + static_cast<uint32_t>(i));
+}
+
+void pinkBlock(uint32_t key, uint32_t counter, PinkState &state,
+               float *output, size_t numSamples) {
+  // White for the whole block first (vectorized), then the filter
+  whiteBlock(key, counter, output, numSamples);
+
+  float b0 = state.b0;
+  float b1 = state.b1;
+  float b2 = state.b2;
+
+  for (size_t i = 0; i < numSamples; i++)
+    output[i] = pink(b0, b1, b2, output[i]);
+
+  state.b0 = b0;
+  state.b1 = b1;
+  state.b2 = b2;
+}
+
+} // namespace dsp::noise
@@ -0,0 +1,44 @@
+#include "dsp/SignalHealth.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace dsp::health {
+
+// ==== <Internal Helpers> ====
+namespace {
+constexpr uint32_t ABS_MASK = 0x7FFFFFFFu;
+constexpr uint32_t EXPONENT_MASK = 0x7F800000u; // also +inf's bits
+constexpr uint32_t MANTISSA_MASK = 0x007FFFFFu; // also the largest denormal
+
+uint32_t absBits(float x) {
+  uint32_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  return bits & ABS_MASK;
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+BlockHealth scanBlock(const float *buffer, size_t numSamples,
+                      float clipLevel) {
+  uint32_t clipBits = absBits(clipLevel);
+  uint32_t nans = 0;
+  uint32_t infs = 0;
+  uint32_t denormals = 0;
+  uint32_t clipped = 0;
+
+  // |x| as an integer orders like |x|: denormals < normals < inf < NaN
+  for (size_t i = 0; i < numSamples; i++) {
+    uint32_t bits = absBits(buffer[i]);
+    nans += static_cast<uint32_t>(bits > EXPONENT_MASK);
+    infs += static_cast<uint32_t>(bits == EXPONENT_MASK);
+    denormals += static_cast<uint32_t>(bits - 1u < MANTISSA_MASK); // not 0
+    clipped +=
+        static_cast<uint32_t>(bits > clipBits && bits < EXPONENT_MASK);
+  }
+
+  return {nans, infs, denormals, clipped};
+}
+
+} // namespace dsp::health
@@ -1,4 +1,5 @@
 #include "dsp/Waveforms.h"
+#include "dsp/FastMath.h"
 #include "dsp/Math.h"
 
 #include <cmath>
@@ -19,10 +20,10 @@ float polyBlep(float deltaTime) {
 }
 
 // Sine wave (band-limited as-is)
-float sine(float phase) { return std::sin(phase * math::TWO_PI_F); }
+float sine(float phase) { return math::fastSinPi(2.0f * phase); }
 
 // NOTE:  using normalized phase results in a cool distorted sound
-float sineNormalized(float phase) { return std::sin(phase); }
+float sineNormalized(float phase) { return math::fastSin(phase); }
 
 //==== SQUARE WAVEFORMS ====
 // Naive Square for LFO and initial PolyBLep value
@@ -100,6 +101,7 @@ float processWaveform(WaveformType type, float phase, float phaseIncrement,
   case WaveformType::Triangle:
     return triangle(phase);
   }
+  return 0.0f; // unreachable, every type is handled above
 }
 
 } // namespace dsp::waveforms
@@ -0,0 +1,149 @@
+#include "dsp/Wavetable.h"
+#include "dsp/Math.h"
+#include "dsp/Waveforms.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace dsp::wavetable {
+
+// ==== <Internal Helpers> ====
+namespace {
+Wavetable builtinTables[static_cast<size_t>(
+    waveforms::WaveformType::WAVEFORM_COUNT)];
+std::once_flag builtinTablesFlag;
+
+// Adds amp * sin(h·θ) + cosAmp * cos(h·θ) over one cycle into _acc_
+// (phasor recurrence instead of TABLE_SIZE calls to sin/cos)
+void addHarmonic(double *acc, size_t harmonic, double sinAmp, double cosAmp) {
+  double step = math::PI_DOUBLE * 2.0 * static_cast<double>(harmonic) /
+                static_cast<double>(TABLE_SIZE);
+  double stepCos = std::cos(step);
+  double stepSin = std::sin(step);
+
+  double c = 1.0;
+  double s = 0.0;
+  for (uint32_t i = 0; i < TABLE_SIZE; i++) {
+    acc[i] += sinAmp * s + cosAmp * c;
+
+    double nextC = c * stepCos - s * stepSin;
+    s = s * stepCos + c * stepSin;
+    c = nextC;
+  }
+}
+
+void buildBuiltinTables() {
+  using WaveformType = waveforms::WaveformType;
+
+  float sinAmps[MAX_HARMONICS];
+  float cosAmps[MAX_HARMONICS];
+
+  // Fourier series of the naive shapes in dsp::waveforms
+  for (size_t t = 0; t < static_cast<size_t>(WaveformType::WAVEFORM_COUNT);
+       t++) {
+    auto type = static_cast<WaveformType>(t);
+
+    for (size_t i = 0; i < MAX_HARMONICS; i++) {
+      float h = static_cast<float>(i + 1);
+      bool isOdd = (i % 2) == 0;
+
+      sinAmps[i] = 0.0f;
+      cosAmps[i] = 0.0f;
+
+      switch (type) {
+      case WaveformType::WAVEFORM_COUNT:
+      case WaveformType::Sine:
+        sinAmps[i] = i == 0 ? 1.0f : 0.0f;
+        break;
+      case WaveformType::Saw: // 2p - 1
+        sinAmps[i] = -2.0f / (math::PI_F * h);
+        break;
+      case WaveformType::Square: // +1 then -1
+        sinAmps[i] = isOdd ? 4.0f / (math::PI_F * h) : 0.0f;
+        break;
+      case WaveformType::Triangle: // -1 at p = 0, +1 at p = 0.5
+        cosAmps[i] =
+            isOdd ? -8.0f / (math::PI_F * math::PI_F * h * h) : 0.0f;
+        break;
+      }
+    }
+
+    buildFromHarmonics(builtinTables[t], sinAmps, cosAmps, MAX_HARMONICS);
+  }
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+void buildFromHarmonics(Wavetable &table, const float *sinAmps,
+                        const float *cosAmps, size_t numHarmonics) {
+  double acc[TABLE_SIZE] = {};
+
+  if (numHarmonics > MAX_HARMONICS)
+    numHarmonics = MAX_HARMONICS;
+
+  // Top level (fewest harmonics) first, each lower level adds the next
+  // octave of harmonics on top of the one above it
+  size_t harmonicsDone = 0;
+  for (uint32_t level = NUM_LEVELS; level > 0; level--) {
+    size_t maxHarmonic = MAX_HARMONICS >> (level - 1);
+
+    for (; harmonicsDone < maxHarmonic && harmonicsDone < numHarmonics;
+         harmonicsDone++) {
+      double sinAmp = static_cast<double>(sinAmps[harmonicsDone]);
+      double cosAmp = static_cast<double>(cosAmps[harmonicsDone]);
+
+      if (sinAmp != 0.0 || cosAmp != 0.0)
+        addHarmonic(acc, harmonicsDone + 1, sinAmp, cosAmp);
+    }
+
+    float *row = table.samples[level - 1];
+    for (uint32_t i = 0; i < TABLE_SIZE; i++)
+      row[i] = static_cast<float>(acc[i]);
+
+    row[TABLE_SIZE] = row[0];
+    row[TABLE_SIZE + 1] = row[1];
+  }
+}
+
+void initBuiltinTables() {
+  std::call_once(builtinTablesFlag, buildBuiltinTables);
+}
+
+const Wavetable &getBuiltinTable(waveforms::WaveformType type) {
+  size_t index = static_cast<size_t>(type);
+  if (index >= static_cast<size_t>(waveforms::WaveformType::WAVEFORM_COUNT))
+    index = 0; // Sine
+
+  return builtinTables[index];
+}
+
+void processWavetableBlock(const Wavetable &table, float &phase,
+                           const float *phaseIncrements, float gain,
+                           float *output, size_t numSamples) {
+  // One mip level per block, picked for the highest pitch in it
+  float maxIncrement = 0.0f;
+  for (size_t i = 0; i < numSamples; i++)
+    maxIncrement =
+        phaseIncrements[i] > maxIncrement ? phaseIncrements[i] : maxIncrement;
+
+  const float *row = table.samples[mipLevel(maxIncrement)];
+  float p = phase; // keep in a register for the whole block
+
+  for (size_t i = 0; i < numSamples; i++) {
+    float position = p * static_cast<float>(TABLE_SIZE);
+    int32_t index = static_cast<int32_t>(position);
+    float frac = position - static_cast<float>(index);
+
+    output[i] += (row[index] + frac * (row[index + 1] - row[index])) * gain;
+
+    p += phaseIncrements[i];
+    if (p >= 1.0f)
+      p -= 1.0f;
+  }
+
+  phase = p;
+}
+
+} // namespace dsp::wavetable
@@ -5,15 +5,21 @@
 namespace synth_io {
 enum class NoteEventType { NoteOff, NoteOn };
 
+/* _timestampNs_ is host time (steady clock), stamped when the event is
+ * queued. The audio callback turns it into a frame offset one buffer later,
+ * so events keep their relative timing instead of snapping to buffer starts
+ */
 struct NoteEvent {
   NoteEventType type = NoteEventType::NoteOff;
   uint8_t midiNote = 0;
   uint8_t velocity = 0;
+  uint64_t timestampNs = 0; // 0 = apply at the start of the next buffer
 };
 
 struct ParamEvent {
   uint8_t id = 0;
-  float value = 0.0f; // Normalized [0, 1]
+  float value = 0.0f;       // Normalized [0, 1]
+  uint64_t timestampNs = 0; // 0 = apply at the start of the next buffer
 };
 
 } // namespace synth_io
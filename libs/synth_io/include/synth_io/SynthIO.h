@@ -19,11 +19,73 @@ enum class BufferFormat {
   Interleaved,    // channels interwoven in single array [LRLRLRLR]
 };
 
+enum class AudioBackend {
+  Platform, // native device (CoreAudio on macOS, else Null)
+  Null,     // no device, realtime-paced callback thread
+  FileSink, // Null + output written to outputPath (float WAV)
+};
+
 struct SessionConfig {
   uint32_t sampleRate = DEFAULT_SAMPLE_RATE;
   uint32_t numFrames = DEFAULT_FRAMES;
   uint16_t numChannels = DEFAULT_CHANNELS;
   BufferFormat bufferFormat = BufferFormat::NonInterleaved;
+
+  AudioBackend backend = AudioBackend::Platform;
+  bool realtimePacing = true;       // Null/FileSink only
+  const char *outputPath = nullptr; // FileSink only
+};
+
+// Deadline accounting (Null/FileSink backends only)
+struct DriverStats {
+  uint64_t callbackCount = 0;
+  uint64_t deadlineMisses = 0; // callback took longer than its period
+  uint64_t xruns = 0;          // driver fell behind schedule
+  double periodMs = 0.0;
+  double lastCallbackMs = 0.0;
+  double avgCallbackMs = 0.0;
+  double maxCallbackMs = 0.0;
+};
+
+// Render timing measured around every audio callback (any backend)
+inline constexpr uint32_t LOAD_HISTOGRAM_BINS = 11; // 10% bins, last >= 100%
+
+struct CallbackStats {
+  // Since start (or the last resetCallbackStats)
+  uint64_t callbackCount = 0;
+  uint64_t deadlineMisses = 0; // events + render took longer than budget
+  double budgetMs = 0.0;       // numFrames / sampleRate
+  double avgCallbackMs = 0.0;
+  double maxCallbackMs = 0.0;
+  uint64_t loadHistogram[LOAD_HISTOGRAM_BINS] = {};
+  uint32_t activeVoices = 0; // after the last callback
+
+  // Callbacks drained from the telemetry ring by this call
+  uint64_t recentCount = 0;
+  double recentAvgLoad = 0.0; // percent of budget
+  double recentMaxLoad = 0.0;
+  uint32_t recentMaxVoices = 0;
+  uint64_t droppedRecords = 0; // ring was full (reader too slow)
+};
+
+/* Producer threads. Each source gets its own lock-free queue, so every
+ * thread pushing events must use its own source (two threads sharing
+ * one source is a data race)
+ */
+enum class EventSource : uint8_t {
+  Midi,     // MIDI device callback
+  Keyboard, // computer keyboard capture loop
+  Terminal, // command line (set)
+  Host,     // embedding app / tools (one thread)
+  SOURCE_COUNT,
+};
+
+// Per-source totals since the session started
+struct ProducerStats {
+  uint64_t notesQueued = 0;
+  uint64_t notesDropped = 0; // queue full
+  uint64_t paramsQueued = 0;
+  uint64_t paramsDropped = 0; // queue full
 };
 
 typedef void (*NoteEventHandler)(NoteEvent noteEvent, void *userContext);
@@ -32,10 +94,14 @@ typedef void (*AudioBufferHandler)(float **outputBuffer, size_t numChannels,
 
 typedef void (*ParamEventHandler)(ParamEvent paramEvent, void *userContext);
 
+// Called on the audio thread after each render (for CallbackStats)
+typedef uint32_t (*ActiveVoicesHandler)(void *userContext);
+
 struct SynthCallbacks {
   ParamEventHandler processParamEvent = nullptr;
   NoteEventHandler processNoteEvent = nullptr;
   AudioBufferHandler processAudioBlock = nullptr;
+  ActiveVoicesHandler getActiveVoices = nullptr; // optional
 };
 
 // ==== Session Handlers ====
@@ -47,11 +113,28 @@ int startSession(hSynthSession sessionPtr);
 int stopSession(hSynthSession sessionPtr);
 int disposeSession(hSynthSession sessionPtr);
 
+// Returns non-zero if the audio backend doesn't track deadlines
+int getDriverStats(hSynthSession sessionPtr, DriverStats &stats);
+
+// Single reader (e.g. the terminal thread); drains the telemetry ring
+int getCallbackStats(hSynthSession sessionPtr, CallbackStats &stats);
+// Cleared by the audio thread on its next callback
+void resetCallbackStats(hSynthSession sessionPtr);
+
+// Any thread; returns non-zero for an invalid source
+int getProducerStats(hSynthSession sessionPtr, EventSource source,
+                     ProducerStats &stats);
+const char *getEventSourceName(EventSource source);
+
 // ==== Note Event Handlers ====
-bool noteOn(hSynthSession sessionPtr, uint8_t midiNote, uint8_t velocity);
-bool noteOff(hSynthSession sessionPtr, uint8_t midiNote, uint8_t velocity);
+// Return false if _source_'s queue is full (event dropped and counted)
+bool noteOn(hSynthSession sessionPtr, EventSource source, uint8_t midiNote,
+            uint8_t velocity);
+bool noteOff(hSynthSession sessionPtr, EventSource source, uint8_t midiNote,
+             uint8_t velocity);
 
 // ==== Parameter Event Handlers ====
-bool setParam(hSynthSession sessionPtr, uint8_t id, float value);
+bool setParam(hSynthSession sessionPtr, EventSource source, uint8_t id,
+              float value);
 
 } // namespace synth_io
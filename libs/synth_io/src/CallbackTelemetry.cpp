@@ -0,0 +1,64 @@
+#include "CallbackTelemetry.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace synth_io {
+
+// ==== <Internal Helpers> ====
+namespace {
+// Single writer, so a plain load/add/store is enough (no RMW needed)
+inline void addRelaxed(std::atomic<uint64_t> &counter, uint64_t amount) {
+  counter.store(counter.load(std::memory_order_relaxed) + amount,
+                std::memory_order_relaxed);
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+void CallbackTelemetry::record(uint64_t elapsedNs, uint64_t callbackBudgetNs,
+                               uint32_t numActiveVoices) {
+  if (isResetRequested.exchange(false, std::memory_order_acquire)) {
+    callbackCount.store(0, std::memory_order_relaxed);
+    deadlineMisses.store(0, std::memory_order_relaxed);
+    droppedRecords.store(0, std::memory_order_relaxed);
+    totalNs.store(0, std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+    for (std::atomic<uint64_t> &bin : loadHistogram)
+      bin.store(0, std::memory_order_relaxed);
+  }
+
+  float loadPercent =
+      callbackBudgetNs > 0
+          ? 100.0f * static_cast<float>(elapsedNs) /
+                static_cast<float>(callbackBudgetNs)
+          : 0.0f;
+
+  // 10% bins, the last one collects every callback at/over budget
+  uint32_t bin = static_cast<uint32_t>(loadPercent * 0.1f);
+  bin = bin < LOAD_HISTOGRAM_BINS - 1 ? bin : LOAD_HISTOGRAM_BINS - 1;
+
+  uint64_t index = callbackCount.load(std::memory_order_relaxed);
+
+  addRelaxed(callbackCount, 1);
+  addRelaxed(totalNs, elapsedNs);
+  addRelaxed(loadHistogram[bin], 1);
+  if (elapsedNs > callbackBudgetNs)
+    addRelaxed(deadlineMisses, 1);
+  if (elapsedNs > maxNs.load(std::memory_order_relaxed))
+    maxNs.store(elapsedNs, std::memory_order_relaxed);
+
+  budgetNs.store(callbackBudgetNs, std::memory_order_relaxed);
+  activeVoices.store(numActiveVoices, std::memory_order_relaxed);
+
+  // ==== Ring (drop when full, never wait on the reader) ====
+  if (!records.push({index, static_cast<float>(elapsedNs) * 1e-6f,
+                     loadPercent, numActiveVoices}))
+    addRelaxed(droppedRecords, 1);
+}
+
+bool CallbackTelemetry::pop(CallbackRecord &callbackRecord) {
+  return records.pop(callbackRecord);
+}
+
+} // namespace synth_io
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "SpscQueue.h"
+
+#include "synth_io/SynthIO.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace synth_io {
+
+// One audio callback, as seen by the terminal thread
+struct CallbackRecord {
+  uint64_t index;        // callback number since start/reset
+  float elapsedMs;       // events + render
+  float loadPercent;     // elapsed / (numFrames / sampleRate)
+  uint32_t activeVoices; // after the render
+};
+
+/* Audio thread -> terminal thread telemetry
+ * Writer side (record) is wait-free: relaxed single-writer totals, and a
+ * SPSC ring that drops (and counts) records when the reader falls behind.
+ * Reader side drains the ring and reads the totals whenever it likes.
+ */
+struct CallbackTelemetry {
+  // ~10s of 512-frame callbacks
+  SpscQueue<CallbackRecord, 1024> records{};
+
+  // ==== Totals (audio thread writes, relaxed) ====
+  std::atomic<uint64_t> callbackCount{0};
+  std::atomic<uint64_t> deadlineMisses{0};
+  std::atomic<uint64_t> droppedRecords{0};
+  std::atomic<uint64_t> totalNs{0};
+  std::atomic<uint64_t> maxNs{0};
+  std::atomic<uint64_t> budgetNs{0};
+  std::atomic<uint32_t> activeVoices{0};
+  std::atomic<uint64_t> loadHistogram[LOAD_HISTOGRAM_BINS] = {};
+
+  // Set by the reader, applied by the audio thread on its next record
+  std::atomic<bool> isResetRequested{false};
+
+  // (Audio Thread)
+  void record(uint64_t elapsedNs, uint64_t callbackBudgetNs,
+              uint32_t numActiveVoices);
+
+  // (Terminal Thread)
+  bool pop(CallbackRecord &callbackRecord);
+};
+
+} // namespace synth_io
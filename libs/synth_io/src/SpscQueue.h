@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace synth_io {
+
+/* ==== Single-producer / single-consumer ring ====
+ * Wait-free on both sides:
+ *   - each index lives on its own cache line, away from the slots, so the
+ *     two threads don't bounce a shared line on every operation
+ *   - each side caches the other side's index and only reloads it
+ *     (acquire) when the ring looks full/empty
+ *   - slots are published with a release store of the owner's index
+ *
+ * SIZE must be a power of two (wrap with a bitmask); holds SIZE - 1 items
+ */
+template <typename T, size_t SIZE> struct SpscQueue {
+  static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0,
+                "SpscQueue SIZE must be a power of two");
+
+  static constexpr size_t CAPACITY{SIZE - 1};
+  static constexpr size_t WRAP{SIZE - 1};
+
+  // ==== Producer side ====
+  alignas(64) std::atomic<size_t> writeIndex{0};
+  size_t cachedReadIndex = 0;
+
+  // ==== Consumer side ====
+  alignas(64) std::atomic<size_t> readIndex{0};
+  size_t cachedWriteIndex = 0;
+
+  alignas(64) T slots[SIZE]{};
+
+  // ============ (Producer Thread) ============
+  // Returns false (item dropped) if the ring is full
+  bool push(const T &item) {
+    size_t currentIndex = writeIndex.load(std::memory_order_relaxed);
+    size_t nextIndex = (currentIndex + 1) & WRAP;
+
+    if (nextIndex == cachedReadIndex) {
+      cachedReadIndex = readIndex.load(std::memory_order_acquire);
+      if (nextIndex == cachedReadIndex)
+        return false;
+    }
+
+    slots[currentIndex] = item;
+    writeIndex.store(nextIndex, std::memory_order_release);
+
+    return true;
+  }
+
+  // Push as many of _items_ as fit (one release store). Returns the count
+  size_t pushBatch(const T *items, size_t count) {
+    size_t currentIndex = writeIndex.load(std::memory_order_relaxed);
+
+    size_t freeSlots = (cachedReadIndex - currentIndex - 1) & WRAP;
+    if (freeSlots < count) {
+      cachedReadIndex = readIndex.load(std::memory_order_acquire);
+      freeSlots = (cachedReadIndex - currentIndex - 1) & WRAP;
+    }
+
+    count = count < freeSlots ? count : freeSlots;
+    for (size_t i = 0; i < count; i++)
+      slots[(currentIndex + i) & WRAP] = items[i];
+
+    if (count)
+      writeIndex.store((currentIndex + count) & WRAP,
+                       std::memory_order_release);
+
+    return count;
+  }
+
+  // ============ (Consumer Thread) ============
+  bool pop(T &item) {
+    size_t currentIndex = readIndex.load(std::memory_order_relaxed);
+
+    if (currentIndex == cachedWriteIndex) {
+      cachedWriteIndex = writeIndex.load(std::memory_order_acquire);
+      if (currentIndex == cachedWriteIndex)
+        return false;
+    }
+
+    item = slots[currentIndex];
+    readIndex.store((currentIndex + 1) & WRAP, std::memory_order_release);
+
+    return true;
+  }
+
+  // Pop up to _maxCount_ items into _out_ (one acquire load, one release
+  // store). Returns the count
+  size_t popBatch(T *out, size_t maxCount) {
+    size_t currentIndex = readIndex.load(std::memory_order_relaxed);
+    cachedWriteIndex = writeIndex.load(std::memory_order_acquire);
+
+    size_t available = (cachedWriteIndex - currentIndex) & WRAP;
+    size_t count = maxCount < available ? maxCount : available;
+
+    for (size_t i = 0; i < count; i++)
+      out[i] = slots[(currentIndex + i) & WRAP];
+
+    if (count)
+      readIndex.store((currentIndex + count) & WRAP,
+                      std::memory_order_release);
+
+    return count;
+  }
+};
+
+} // namespace synth_io
@@ -1,5 +1,6 @@
 #include "synth_io/SynthIO.h"
 
+#include "CallbackTelemetry.h"
 #include "NoteEventQueue.h"
 #include "ParamEventQueue.h"
 
@@ -7,6 +8,8 @@
 #include "audio_io/AudioIOTypes.h"
 #include "audio_io/AudioIOTypesFwd.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 
@@ -14,41 +17,249 @@ namespace synth_io {
 using AudioBuffer = audio_io::AudioBuffer;
 using hAudioSession = audio_io::hAudioSession;
 
+inline constexpr size_t NUM_SOURCES =
+    static_cast<size_t>(EventSource::SOURCE_COUNT);
+
+/* One SPSC lane per producer thread (EventSource): producers never share
+ * a queue, so pushes stay wait-free without any CAS. The audio thread
+ * drains every lane and merges them by timestamp
+ */
+struct EventLane {
+  NoteEventQueue notes{};
+  ParamEventQueue params{};
+
+  // Written by the lane's producer only (relaxed)
+  alignas(64) std::atomic<uint64_t> notesQueued{0};
+  std::atomic<uint64_t> notesDropped{0};
+  std::atomic<uint64_t> paramsQueued{0};
+  std::atomic<uint64_t> paramsDropped{0};
+};
+
+enum class ScheduledEventType { Note, Param };
+
+// Queued event placed on a frame of the buffer being rendered
+struct ScheduledEvent {
+  uint32_t frame = 0;
+  uint64_t timestampNs = 0; // merge order between lanes
+  ScheduledEventType type = ScheduledEventType::Note;
+  NoteEvent note{};
+  ParamEvent param{};
+};
+
+// Each lane's note and param queue is one run, already in time order
+inline constexpr size_t NUM_RUNS = NUM_SOURCES * 2;
+inline constexpr size_t RUN_CAPACITY =
+    NoteEventQueue::CAPACITY > ParamEventQueue::CAPACITY
+        ? NoteEventQueue::CAPACITY
+        : ParamEventQueue::CAPACITY;
+
+// Every queue fully drained in one callback
+inline constexpr size_t MAX_SCHEDULED_EVENTS = NUM_RUNS * RUN_CAPACITY;
+
 struct SynthSession {
-  NoteEventQueue noteEventQueue{};
-  ParamEventQueue paramEventQueue{};
+  EventLane lanes[NUM_SOURCES];
 
-  AudioBufferHandler processAudioBlock;
+  // ==== Audio thread only ====
+  NoteEvent noteBatch[NoteEventQueue::CAPACITY];
+  ParamEvent paramBatch[ParamEventQueue::CAPACITY];
+  ScheduledEvent runs[NUM_RUNS][RUN_CAPACITY];
+  ScheduledEvent scheduledEvents[MAX_SCHEDULED_EVENTS];
+  float **segmentPtrs = nullptr; // numChannels pointers into the buffer
 
-  NoteEventHandler processNoteEvent;
-  ParamEventHandler processParamEvent;
+  AudioBufferHandler processAudioBlock = nullptr;
 
-  hAudioSession audioSession;
-  void *userContext;
+  NoteEventHandler processNoteEvent = nullptr;
+  ParamEventHandler processParamEvent = nullptr;
+  ActiveVoicesHandler getActiveVoices = nullptr;
+
+  CallbackTelemetry telemetry{};
+  double nsPerFrame = 0.0; // 1e9 / sampleRate
+
+  hAudioSession audioSession = nullptr;
+  void *userContext = nullptr;
 };
 using hSynthSession = SynthSession *;
 
-static void audioCallback(AudioBuffer buffer, void *context) {
-  auto *ctx = static_cast<SynthSession *>(context);
+// ==== <Internal Helpers> ====
+namespace {
+uint64_t nowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/* Events stamped during the previous buffer period land on the matching
+ * frame of this buffer (fixed one-buffer latency, no jitter). Anything
+ * older starts the buffer, anything newer (stamped mid-callback) ends it
+ */
+uint32_t frameForTimestamp(uint64_t timestampNs, uint64_t windowStartNs,
+                           double framesPerNs, uint32_t numFrames) {
+  if (timestampNs <= windowStartNs || numFrames == 0)
+    return 0;
+
+  double frame =
+      static_cast<double>(timestampNs - windowStartNs) * framesPerNs;
+
+  return frame < static_cast<double>(numFrames - 1)
+             ? static_cast<uint32_t>(frame)
+             : numFrames - 1;
+}
+
+// Single-writer counter (the lane's producer), no RMW needed
+inline void incrementRelaxed(std::atomic<uint64_t> &counter) {
+  counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+inline bool isEarlier(const ScheduledEvent &a, const ScheduledEvent &b) {
+  return a.frame < b.frame ||
+         (a.frame == b.frame && a.timestampNs < b.timestampNs);
+}
+
+// Drain every lane into scheduledEvents, ordered by frame then timestamp
+// (ties keep lane order, params before notes). Returns the count
+size_t scheduleEvents(SynthSession &session, uint64_t windowStartNs,
+                      uint32_t numFrames) {
+  double framesPerNs = 1.0 / session.nsPerFrame;
+  size_t runSizes[NUM_RUNS] = {};
+  size_t numEvents = 0;
+
+  // One acquire/release pair per queue, whatever the burst size
+  for (size_t l = 0; l < NUM_SOURCES; l++) {
+    EventLane &lane = session.lanes[l];
 
-  if (ctx->processParamEvent) {
-    ParamEvent paramEvent;
-    while (ctx->paramEventQueue.pop(paramEvent)) {
-      ctx->processParamEvent(paramEvent, ctx->userContext);
+    if (session.processParamEvent) {
+      ScheduledEvent *run = session.runs[l * 2];
+      size_t numParams =
+          lane.params.popBatch(session.paramBatch, ParamEventQueue::CAPACITY);
+
+      for (size_t i = 0; i < numParams; i++) {
+        const ParamEvent &param = session.paramBatch[i];
+        run[i].frame = frameForTimestamp(param.timestampNs, windowStartNs,
+                                         framesPerNs, numFrames);
+        run[i].timestampNs = param.timestampNs;
+        run[i].type = ScheduledEventType::Param;
+        run[i].param = param;
+      }
+
+      runSizes[l * 2] = numParams;
+      numEvents += numParams;
+    }
+
+    if (session.processNoteEvent) {
+      ScheduledEvent *run = session.runs[l * 2 + 1];
+      size_t numNotes =
+          lane.notes.popBatch(session.noteBatch, NoteEventQueue::CAPACITY);
+
+      for (size_t i = 0; i < numNotes; i++) {
+        const NoteEvent &note = session.noteBatch[i];
+        run[i].frame = frameForTimestamp(note.timestampNs, windowStartNs,
+                                         framesPerNs, numFrames);
+        run[i].timestampNs = note.timestampNs;
+        run[i].type = ScheduledEventType::Note;
+        run[i].note = note;
+      }
+
+      runSizes[l * 2 + 1] = numNotes;
+      numEvents += numNotes;
     }
   }
 
-  if (ctx->processNoteEvent) {
-    NoteEvent noteEvent;
-    while (ctx->noteEventQueue.pop(noteEvent)) {
-      ctx->processNoteEvent(noteEvent, ctx->userContext);
+  // k-way merge of the (already ordered) runs
+  size_t cursors[NUM_RUNS] = {};
+  for (size_t e = 0; e < numEvents; e++) {
+    size_t earliest = NUM_RUNS;
+
+    for (size_t r = 0; r < NUM_RUNS; r++) {
+      if (cursors[r] == runSizes[r])
+        continue;
+
+      if (earliest == NUM_RUNS ||
+          isEarlier(session.runs[r][cursors[r]],
+                    session.runs[earliest][cursors[earliest]]))
+        earliest = r;
     }
+
+    session.scheduledEvents[e] = session.runs[earliest][cursors[earliest]++];
   }
 
-  if (ctx->processAudioBlock) {
-    ctx->processAudioBlock(buffer.channelPtrs, buffer.numChannels,
-                           buffer.numFrames, ctx->userContext);
+  return numEvents;
+}
+
+bool pushNote(SynthSession &session, EventSource source,
+              const NoteEvent &event) {
+  if (source >= EventSource::SOURCE_COUNT)
+    return false;
+
+  EventLane &lane = session.lanes[static_cast<size_t>(source)];
+
+  if (!lane.notes.push(event)) {
+    incrementRelaxed(lane.notesDropped);
+    return false;
   }
+
+  incrementRelaxed(lane.notesQueued);
+  return true;
+}
+
+void dispatchEvent(SynthSession &session, const ScheduledEvent &event) {
+  if (event.type == ScheduledEventType::Note)
+    session.processNoteEvent(event.note, session.userContext);
+  else
+    session.processParamEvent(event.param, session.userContext);
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+static void audioCallback(AudioBuffer buffer, void *context) {
+  auto *ctx = static_cast<SynthSession *>(context);
+  uint64_t startNs = nowNs();
+  uint64_t periodNs =
+      static_cast<uint64_t>(ctx->nsPerFrame * buffer.numFrames);
+  uint64_t windowStartNs = startNs > periodNs ? startNs - periodNs : 0;
+
+  size_t numEvents = scheduleEvents(*ctx, windowStartNs, buffer.numFrames);
+
+  // Interleaved buffers can't be offset per channel: events start the
+  // buffer (previous behaviour)
+  bool isSplittable = buffer.format == audio_io::BufferFormat::NonInterleaved;
+
+  if (!ctx->processAudioBlock || !isSplittable) {
+    for (size_t e = 0; e < numEvents; e++)
+      dispatchEvent(*ctx, ctx->scheduledEvents[e]);
+
+    if (ctx->processAudioBlock)
+      ctx->processAudioBlock(buffer.channelPtrs, buffer.numChannels,
+                             buffer.numFrames, ctx->userContext);
+  } else {
+    // Render up to each event's frame, apply it, carry on
+    uint32_t frame = 0;
+    size_t nextEvent = 0;
+
+    while (frame < buffer.numFrames) {
+      while (nextEvent < numEvents &&
+             ctx->scheduledEvents[nextEvent].frame <= frame)
+        dispatchEvent(*ctx, ctx->scheduledEvents[nextEvent++]);
+
+      uint32_t segmentEnd = nextEvent < numEvents
+                                ? ctx->scheduledEvents[nextEvent].frame
+                                : buffer.numFrames;
+
+      for (uint32_t ch = 0; ch < buffer.numChannels; ch++)
+        ctx->segmentPtrs[ch] = buffer.channelPtrs[ch] + frame;
+
+      ctx->processAudioBlock(ctx->segmentPtrs, buffer.numChannels,
+                             segmentEnd - frame, ctx->userContext);
+      frame = segmentEnd;
+    }
+  }
+
+  // ==== Telemetry (wait-free) ====
+  uint32_t activeVoices =
+      ctx->getActiveVoices ? ctx->getActiveVoices(ctx->userContext) : 0;
+
+  ctx->telemetry.record(nowNs() - startNs, periodNs, activeVoices);
 }
 
 // ==== PUBLIC APIS ====
@@ -61,7 +272,10 @@ hSynthSession initSession(SessionConfig userConfig,
   sessionPtr->processParamEvent = userCallbacks.processParamEvent;
   sessionPtr->processNoteEvent = userCallbacks.processNoteEvent;
   sessionPtr->processAudioBlock = userCallbacks.processAudioBlock;
+  sessionPtr->getActiveVoices = userCallbacks.getActiveVoices;
   sessionPtr->userContext = userContext;
+  sessionPtr->nsPerFrame = 1e9 / static_cast<double>(userConfig.sampleRate);
+  sessionPtr->segmentPtrs = new float *[userConfig.numChannels]();
 
   // 2. Setup audio_io
   audio_io::Config config{};
@@ -70,10 +284,19 @@ hSynthSession initSession(SessionConfig userConfig,
   config.numFrames = userConfig.numFrames;
   config.bufferFormat =
       static_cast<audio_io::BufferFormat>(userConfig.bufferFormat);
+  config.backend = static_cast<audio_io::Backend>(userConfig.backend);
+  config.realtimePacing = userConfig.realtimePacing;
+  config.outputPath = userConfig.outputPath;
 
   sessionPtr->audioSession =
       audio_io::setupAudioSession(config, audioCallback, sessionPtr);
 
+  if (!sessionPtr->audioSession) {
+    delete[] sessionPtr->segmentPtrs;
+    delete sessionPtr;
+    return nullptr;
+  }
+
   return sessionPtr;
 };
 
@@ -92,28 +315,151 @@ int disposeSession(hSynthSession sessionPtr) {
     return 1;
   }
 
+  delete[] sessionPtr->segmentPtrs;
   delete sessionPtr;
 
   return 0;
 }
 
+int getDriverStats(hSynthSession sessionPtr, DriverStats &stats) {
+  audio_io::DriverStats driverStats{};
+
+  int status = audio_io::getDriverStats(sessionPtr->audioSession, driverStats);
+  if (status != 0)
+    return status;
+
+  stats.callbackCount = driverStats.callbackCount;
+  stats.deadlineMisses = driverStats.deadlineMisses;
+  stats.xruns = driverStats.xruns;
+  stats.periodMs = driverStats.periodMs;
+  stats.lastCallbackMs = driverStats.lastCallbackMs;
+  stats.avgCallbackMs = driverStats.avgCallbackMs;
+  stats.maxCallbackMs = driverStats.maxCallbackMs;
+
+  return 0;
+}
+
+int getCallbackStats(hSynthSession sessionPtr, CallbackStats &stats) {
+  CallbackTelemetry &telemetry = sessionPtr->telemetry;
+
+  // Recent window first, so the totals below include every drained record
+  stats.recentCount = 0;
+  stats.recentAvgLoad = 0.0;
+  stats.recentMaxLoad = 0.0;
+  stats.recentMaxVoices = 0;
+
+  CallbackRecord record;
+  while (telemetry.pop(record)) {
+    double load = static_cast<double>(record.loadPercent);
+
+    stats.recentCount++;
+    stats.recentAvgLoad += load;
+    stats.recentMaxLoad =
+        load > stats.recentMaxLoad ? load : stats.recentMaxLoad;
+    stats.recentMaxVoices = record.activeVoices > stats.recentMaxVoices
+                                ? record.activeVoices
+                                : stats.recentMaxVoices;
+  }
+
+  if (stats.recentCount)
+    stats.recentAvgLoad /= static_cast<double>(stats.recentCount);
+
+  // Totals: each value is read on its own (relaxed), so they may be one
+  // callback apart from each other
+  stats.callbackCount = telemetry.callbackCount.load(std::memory_order_relaxed);
+  stats.deadlineMisses =
+      telemetry.deadlineMisses.load(std::memory_order_relaxed);
+  stats.droppedRecords =
+      telemetry.droppedRecords.load(std::memory_order_relaxed);
+  stats.activeVoices = telemetry.activeVoices.load(std::memory_order_relaxed);
+
+  uint64_t totalNs = telemetry.totalNs.load(std::memory_order_relaxed);
+  stats.budgetMs = static_cast<double>(
+                       telemetry.budgetNs.load(std::memory_order_relaxed)) *
+                   1e-6;
+  stats.avgCallbackMs = stats.callbackCount
+                            ? static_cast<double>(totalNs) * 1e-6 /
+                                  static_cast<double>(stats.callbackCount)
+                            : 0.0;
+  stats.maxCallbackMs =
+      static_cast<double>(telemetry.maxNs.load(std::memory_order_relaxed)) *
+      1e-6;
+
+  for (uint32_t b = 0; b < LOAD_HISTOGRAM_BINS; b++)
+    stats.loadHistogram[b] =
+        telemetry.loadHistogram[b].load(std::memory_order_relaxed);
+
+  return 0;
+}
+
+void resetCallbackStats(hSynthSession sessionPtr) {
+  CallbackRecord record;
+  while (sessionPtr->telemetry.pop(record)) {
+  }
+
+  sessionPtr->telemetry.isResetRequested.store(true,
+                                               std::memory_order_release);
+}
+
+int getProducerStats(hSynthSession sessionPtr, EventSource source,
+                     ProducerStats &stats) {
+  size_t l = static_cast<size_t>(source);
+  if (l >= NUM_SOURCES)
+    return 1;
+
+  const EventLane &lane = sessionPtr->lanes[l];
+  stats.notesQueued = lane.notesQueued.load(std::memory_order_relaxed);
+  stats.notesDropped = lane.notesDropped.load(std::memory_order_relaxed);
+  stats.paramsQueued = lane.paramsQueued.load(std::memory_order_relaxed);
+  stats.paramsDropped = lane.paramsDropped.load(std::memory_order_relaxed);
+
+  return 0;
+}
+
+const char *getEventSourceName(EventSource source) {
+  switch (source) {
+  case EventSource::Midi:
+    return "midi";
+  case EventSource::Keyboard:
+    return "keyboard";
+  case EventSource::Terminal:
+    return "terminal";
+  case EventSource::Host:
+    return "host";
+  case EventSource::SOURCE_COUNT:
+    break;
+  }
+  return "unknown";
+}
+
 // ==== Note Event Handlers ====
-bool noteOn(hSynthSession sessionPtr, uint8_t midiNote, uint8_t velocity) {
-  // TODO(nico): replicate emplace_back() to reduce copy;
-  return sessionPtr->noteEventQueue.push(
-      {NoteEventType::NoteOn, midiNote, velocity});
+bool noteOn(hSynthSession sessionPtr, EventSource source, uint8_t midiNote,
+            uint8_t velocity) {
+  return pushNote(*sessionPtr, source,
+                  {NoteEventType::NoteOn, midiNote, velocity, nowNs()});
 }
 
-bool noteOff(hSynthSession sessionPtr, uint8_t midiNote, uint8_t velocity) {
-  // TODO(nico): replicate emplace_back() to reduce copy;
-  return sessionPtr->noteEventQueue.push(
-      {NoteEventType::NoteOff, midiNote, velocity});
+bool noteOff(hSynthSession sessionPtr, EventSource source, uint8_t midiNote,
+             uint8_t velocity) {
+  return pushNote(*sessionPtr, source,
+                  {NoteEventType::NoteOff, midiNote, velocity, nowNs()});
 }
 
 // ==== Parameter Event Handlers ====
-bool setParam(hSynthSession sessionPtr, uint8_t id, float value) {
-  // TODO(nico): replicate emplace_back() to reduce copy;
-  return sessionPtr->paramEventQueue.push({id, value});
+bool setParam(hSynthSession sessionPtr, EventSource source, uint8_t id,
+              float value) {
+  if (source >= EventSource::SOURCE_COUNT)
+    return false;
+
+  EventLane &lane = sessionPtr->lanes[static_cast<size_t>(source)];
+
+  if (!lane.params.push({id, value, nowNs()})) {
+    incrementRelaxed(lane.paramsDropped);
+    return false;
+  }
+
+  incrementRelaxed(lane.paramsQueued);
+  return true;
 }
 
 } // namespace synth_io
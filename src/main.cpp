@@ -32,6 +32,11 @@ static void processAudioBlock(float **outputBuffer, size_t numChannels,
   engine->processAudioBlock(outputBuffer, numChannels, numFrames);
 }
 
+static uint32_t getActiveVoices(void *myContext) {
+  auto engine = static_cast<synth::Engine *>(myContext);
+  return engine->voicePool.activeCount;
+}
+
 static void getUserInput(synth::Engine &engine,
                          synth_io::hSynthSession sessionPtr) {
   bool isRunning = true;
@@ -77,6 +82,7 @@ int main() {
   synth_io::SynthCallbacks sessionCallbacks{};
   sessionCallbacks.processAudioBlock = processAudioBlock;
   sessionCallbacks.processNoteEvent = processNoteEvent;
+  sessionCallbacks.getActiveVoices = getActiveVoices;
 
 #if !OLD
   sessionCallbacks.processParamEvent = processParamEvent;
@@ -85,6 +91,11 @@ int main() {
   synth_io::hSynthSession session =
       synth_io::initSession(sessionConfig, sessionCallbacks, &engine);
 
+  if (!session) {
+    printf("Unable to initialize audio session\n");
+    return 1;
+  }
+
   synth_io::startSession(session);
 
   auto midiSession = synth::utils::initMidiSession(session);
@@ -108,6 +119,7 @@ int main() {
 
   synth_io::stopSession(session);
   synth_io::disposeSession(session);
+  synth::disposeEngine(engine);
 
   return 0;
 }
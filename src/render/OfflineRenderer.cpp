@@ -0,0 +1,232 @@
+#include "OfflineRenderer.h"
+
+#include "synth/Engine.h"
+#include "synth/ModMatrix.h"
+#include "synth/ParamBindings.h"
+
+#include "utils/WavWriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace synth::render {
+namespace pb = param::bindings;
+
+// ==== Internal Helpers ====
+namespace {
+
+void applyEvent(Engine &engine, const RenderEvent &event) {
+  if (event.type == RenderEventType::Note) {
+    engine.processNoteEvent(event.note);
+  } else {
+    engine.processParamEvent(event.param);
+  }
+}
+
+uint64_t secondsToFrame(float seconds, float sampleRate) {
+  if (seconds <= 0.0f)
+    return 0;
+  return static_cast<uint64_t>(std::llround(seconds * sampleRate));
+}
+
+// Parse "<seconds> <command> <args...>" into a RenderEvent
+// Returns false for malformed lines
+bool parseEventLine(std::istringstream &iss, float seconds, float sampleRate,
+                    RenderEvent &event) {
+  std::string cmd;
+  iss >> cmd;
+
+  event.frame = secondsToFrame(seconds, sampleRate);
+
+  if (cmd == "on" || cmd == "off") {
+    int midiNote = 0;
+    int velocity = 127;
+
+    if (!(iss >> midiNote) || midiNote < 1 || midiNote > 127)
+      return false;
+
+    iss >> velocity; // optional
+    velocity = std::clamp(velocity, 0, 127);
+
+    event.type = RenderEventType::Note;
+    event.note.type = cmd == "on" ? synth_io::NoteEventType::NoteOn
+                                  : synth_io::NoteEventType::NoteOff;
+    event.note.midiNote = static_cast<uint8_t>(midiNote);
+    event.note.velocity = static_cast<uint8_t>(velocity);
+    return true;
+  }
+
+  if (cmd == "set") {
+    std::string paramName;
+    iss >> paramName;
+
+    pb::ParamMapping param = pb::findParamByName(paramName.c_str());
+    if (param.id == pb::PARAM_COUNT)
+      return false;
+
+    event.type = RenderEventType::Param;
+    event.param.id = static_cast<uint8_t>(param.id);
+    event.param.value = pb::parseParamValue(param.type, iss);
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace
+
+// ==== APIs ====
+int renderToFile(Engine &engine, const RenderEvent *events, size_t numEvents,
+                 uint64_t numFrames, const std::string &outputPath,
+                 const RenderConfig &config, RenderStats &stats) {
+  if (config.numChannels == 0 ||
+      buffers::validateFrames(config.blockSize)) {
+    printf("Invalid render config (channels: %u, blockSize: %u, max: %u)\n",
+           config.numChannels, config.blockSize, buffers::MAX_FRAMES);
+    return 1;
+  }
+
+  // Nothing else renders with this engine, so resizing can't stall
+  if (resizeEngineBuffers(engine, config.blockSize)) {
+    printf("Unable to size engine buffers for %u frames\n", config.blockSize);
+    return 1;
+  }
+
+  WavWriter::WavStream stream{};
+  if (!WavWriter::openWavStream(stream, outputPath,
+                                static_cast<int32_t>(engine.sampleRate),
+                                static_cast<int16_t>(config.numChannels),
+                                config.sampleFormat)) {
+    printf("Unable to open '%s' for writing\n", outputPath.c_str());
+    return 2;
+  }
+
+  // Engine writes the file's frame layout directly
+  size_t numChannels = config.numChannels;
+  std::vector<float> interleaved(numChannels * config.blockSize);
+
+  stats = RenderStats{};
+  const VoicePool &pool = engine.voicePool;
+  uint64_t startEngineBlocks = pool.renderedBlocks;
+  uint64_t startSilentBlocks = pool.silentBlocks;
+  uint64_t startRetiredVoices = pool.earlyRetiredVoices;
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  uint64_t frame = 0;
+  size_t nextEvent = 0;
+
+  while (frame < numFrames) {
+    // Apply everything due at (or before) this frame
+    while (nextEvent < numEvents && events[nextEvent].frame <= frame)
+      applyEvent(engine, events[nextEvent++]);
+
+    // Split the block at the next event so it lands on its exact frame
+    uint64_t blockEnd = std::min(frame + config.blockSize, numFrames);
+    if (nextEvent < numEvents && events[nextEvent].frame < blockEnd)
+      blockEnd = events[nextEvent].frame;
+
+    uint32_t blockFrames = static_cast<uint32_t>(blockEnd - frame);
+
+    engine.processAudioBlockInterleaved(interleaved.data(), numChannels,
+                                        blockFrames);
+
+    WavWriter::writeWavStream(stream, interleaved.data(), blockFrames);
+
+    frame = blockEnd;
+    stats.blocksRendered++;
+  }
+
+  WavWriter::closeWavStream(stream);
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - startTime;
+
+  stats.framesRendered = frame;
+  stats.engineBlocks = pool.renderedBlocks - startEngineBlocks;
+  stats.silentBlocks = pool.silentBlocks - startSilentBlocks;
+  stats.earlyRetiredVoices = pool.earlyRetiredVoices - startRetiredVoices;
+  stats.elapsedSeconds = elapsed.count();
+
+  double audioSeconds =
+      static_cast<double>(frame) / static_cast<double>(engine.sampleRate);
+  if (stats.elapsedSeconds > 0.0)
+    stats.realtimeFactor = audioSeconds / stats.elapsedSeconds;
+
+  return 0;
+}
+
+int loadScore(const std::string &path, Engine &engine,
+              std::vector<RenderEvent> &events, uint64_t &endFrame) {
+  std::ifstream file(path);
+  if (!file) {
+    printf("Unable to open score '%s'\n", path.c_str());
+    return 1;
+  }
+
+  endFrame = 0;
+
+  std::string line;
+  uint32_t lineNumber = 0;
+
+  while (std::getline(file, line)) {
+    lineNumber++;
+
+    std::istringstream iss(line);
+    std::string first;
+
+    // Skip blank lines and comments
+    if (!(iss >> first) || first[0] == '#')
+      continue;
+
+    if (first == "mod") {
+      mod_matrix::parseModCommand(iss, engine.voicePool.modMatrix);
+      continue;
+    }
+
+    if (first == "end") {
+      float seconds = 0.0f;
+      if (!(iss >> seconds)) {
+        printf("Score line %u: expected 'end <seconds>'\n", lineNumber);
+        return 2;
+      }
+      endFrame = secondsToFrame(seconds, engine.sampleRate);
+      continue;
+    }
+
+    RenderEvent event{};
+    float seconds = 0.0f;
+
+    try {
+      seconds = std::stof(first);
+    } catch (...) {
+      printf("Score line %u: expected time in seconds, got '%s'\n", lineNumber,
+             first.c_str());
+      return 2;
+    }
+
+    if (!parseEventLine(iss, seconds, engine.sampleRate, event)) {
+      printf("Score line %u: invalid event '%s'\n", lineNumber, line.c_str());
+      return 2;
+    }
+
+    events.push_back(event);
+  }
+
+  // Keep file order for events sharing the same frame
+  std::stable_sort(events.begin(), events.end(),
+                   [](const RenderEvent &a, const RenderEvent &b) {
+                     return a.frame < b.frame;
+                   });
+
+  return 0;
+}
+
+} // namespace synth::render
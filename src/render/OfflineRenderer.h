@@ -0,0 +1,78 @@
+#pragma once
+
+#include "synth/Engine.h"
+
+#include "synth_io/Events.h"
+
+#include "utils/WavWriter.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* Offline (headless) rendering
+ * Drives Engine::processAudioBlock directly, as fast as the CPU allows,
+ * without synth_io/audio_io or any audio device. Output is streamed to disk
+ * block by block so render length is not limited by memory.
+ */
+namespace synth::render {
+using NoteEvent = synth_io::NoteEvent;
+using ParamEvent = synth_io::ParamEvent;
+using SampleFormat = WavWriter::SampleFormat;
+
+enum class RenderEventType { Note, Param };
+
+// Timeline event. _frame_ is absolute (frames from start of render)
+struct RenderEvent {
+  uint64_t frame = 0;
+  RenderEventType type = RenderEventType::Note;
+  NoteEvent note{};
+  ParamEvent param{}; // value is denormalized (same as terminal 'set')
+};
+
+struct RenderConfig {
+  uint16_t numChannels = 2;
+  // Max frames per engine call (1 - buffers::MAX_FRAMES), by default the
+  // engine's own largest expected block
+  uint32_t blockSize = EngineConfig{}.numFrames;
+  SampleFormat sampleFormat = SampleFormat::Float32;
+};
+
+struct RenderStats {
+  uint64_t framesRendered = 0;
+  uint64_t blocksRendered = 0;
+  double elapsedSeconds = 0.0;
+  double realtimeFactor = 0.0; // audio seconds rendered per wall second
+
+  // Engine blocks (ENGINE_BLOCK_SIZE frames or less), and how many of
+  // them had no voice to render
+  uint64_t engineBlocks = 0;
+  uint64_t silentBlocks = 0;
+  uint64_t earlyRetiredVoices = 0; // released below the silence threshold
+};
+
+/* Render _numFrames_ frames to a WAV file.
+ * _events_ MUST be sorted by frame. Events are applied on their exact frame
+ * (engine calls are split at event boundaries).
+ *
+ * Returns 0 on success
+ */
+int renderToFile(Engine &engine, const RenderEvent *events, size_t numEvents,
+                 uint64_t numFrames, const std::string &outputPath,
+                 const RenderConfig &config, RenderStats &stats);
+
+/* Score file (one command per line, '#' for comments):
+ *   <seconds> on <midiNote> [velocity]
+ *   <seconds> off <midiNote>
+ *   <seconds> set <param> <value>      (same names/values as terminal 'set')
+ *   mod add <source> <dest> <amount>   (applied to engine before render)
+ *   end <seconds>                      (total render length)
+ *
+ * Events are returned sorted by frame. _endFrame_ is 0 if no 'end' given.
+ * Returns 0 on success
+ */
+int loadScore(const std::string &path, Engine &engine,
+              std::vector<RenderEvent> &events, uint64_t &endFrame);
+
+} // namespace synth::render
@@ -2,12 +2,15 @@
 #include "ParamBindings.h"
 #include "VoicePool.h"
 
+#include "dsp/Denormals.h"
+
 #include "synth_io/Events.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 
 namespace synth {
 using NoteEvent = synth_io::NoteEvent;
@@ -15,14 +18,38 @@ using ParamEvent = synth_io::ParamEvent;
 
 Engine createEngine(const EngineConfig &config) {
   Engine engine{};
+  engine.sampleRate = config.sampleRate;
 
   voices::updateVoicePoolConfig(engine.voicePool, config);
 
   param::bindings::initParamBindings(engine);
+  param::smoothing::initParamSmoother(engine.paramSmoother,
+                                      engine.paramBindings, config.sampleRate,
+                                      config.paramSmoothingMs);
+
+  uint32_t maxFrames = config.numFrames;
+  if (buffers::validateFrames(maxFrames))
+    maxFrames = synth_io::DEFAULT_FRAMES;
+
+  engine.buffers = buffers::createEngineBuffers(maxFrames);
 
   return engine;
 }
 
+void disposeEngine(Engine &engine) {
+  voices::disposeVoicePool(engine.voicePool);
+
+  buffers::destroyEngineBuffers(engine.buffers);
+  engine.buffers = nullptr;
+}
+
+int resizeEngineBuffers(Engine &engine, uint32_t maxFrames) {
+  if (!engine.buffers)
+    return 1;
+
+  return buffers::resizeEngineBuffers(*engine.buffers, maxFrames);
+}
+
 void Engine::processParamEvent(const ParamEvent &event) {
   param::bindings::setParamValueByID(*this, static_cast<ParamID>(event.id),
                                      event.value);
@@ -49,19 +76,72 @@ void Engine::processAudioBlock(float **outputBuffer, size_t numChannels,
    * TODO(nico): mess with ENGINE_BLOCK_SIZE value (currently 64) to see
    * how it effects things
    */
+  if (numChannels == 0)
+    return;
+
+  // Decaying filter/envelope tails flush to 0 instead of going denormal
+  // (the host's FP mode is restored on return)
+  dsp::denormals::ScopedFlushToZero flushToZero;
+
+  // Render straight into the first channel (the host's buffer when the
+  // backend hands it over), no intermediate mix buffer
+  float *mono = outputBuffer[0];
+
+  // Notes only start between calls: no voice now means a silent call
+  bool isSilent = voicePool.activeCount == 0;
+
   uint32_t offset = 0;
   while (offset < numFrames) {
     uint32_t blockSize =
         std::min(ENGINE_BLOCK_SIZE, static_cast<uint32_t>(numFrames) - offset);
-    voices::processVoices(voicePool, poolBuffer + offset, blockSize);
+    param::bindings::advanceParamSmoothing(*this, blockSize);
+    voices::processVoices(voicePool, mono + offset, blockSize);
     offset += blockSize;
   }
 
-  for (size_t frame = 0; frame < numFrames; frame++) {
-    for (size_t ch = 0; ch < numChannels; ch++) {
-      outputBuffer[ch][frame] = poolBuffer[frame];
+  // Engine is mono: remaining channels get a copy of the first
+  for (size_t ch = 1; ch < numChannels; ch++) {
+    if (isSilent)
+      std::memset(outputBuffer[ch], 0, numFrames * sizeof(float));
+    else
+      std::memcpy(outputBuffer[ch], mono, numFrames * sizeof(float));
+  }
+}
+
+void Engine::processAudioBlockInterleaved(float *output, size_t numChannels,
+                                          size_t numFrames) {
+  if (numChannels == 0)
+    return;
+
+  // Render into the arena, then spread into the host's frames. Blocks
+  // larger than the arena go through it in arena-sized chunks
+  buffers::BufferArena *arena = buffers::acquireArena(*buffers);
+  float *mono = arena->mono;
+
+  size_t frame = 0;
+  while (frame < numFrames) {
+    size_t chunkFrames = std::min(static_cast<size_t>(arena->maxFrames),
+                                  numFrames - frame);
+
+    bool isSilent = voicePool.activeCount == 0;
+
+    float *chunkPtrs[1] = {mono};
+    processAudioBlock(chunkPtrs, 1, chunkFrames);
+
+    float *dst = output + frame * numChannels;
+    if (isSilent) {
+      std::memset(dst, 0, chunkFrames * numChannels * sizeof(float));
+    } else {
+      for (size_t i = 0; i < chunkFrames; i++) {
+        for (size_t ch = 0; ch < numChannels; ch++)
+          dst[i * numChannels + ch] = mono[i];
+      }
     }
+
+    frame += chunkFrames;
   }
+
+  buffers::releaseArena(*buffers);
 }
 
 } // namespace synth
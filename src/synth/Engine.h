@@ -1,6 +1,8 @@
 #pragma once
 
+#include "EngineBuffers.h"
 #include "ParamBindings.h"
+#include "ParamSmoothing.h"
 #include "VoicePool.h"
 
 #include "dsp/Waveforms.h"
@@ -24,19 +26,21 @@ using ParamID = param::bindings::ParamID;
 
 struct EngineConfig : VoiceConfig {
   float sampleRate = synth_io::DEFAULT_SAMPLE_RATE;
-  uint32_t numFrames = synth_io::DEFAULT_FRAMES;
+  uint32_t numFrames = synth_io::DEFAULT_FRAMES; // largest expected block
+
+  // Glide time for FLOAT param changes (0: params jump)
+  float paramSmoothingMs = param::smoothing::DEFAULT_SMOOTHING_MS;
 };
 
 struct Engine {
-  static constexpr uint32_t NUM_FRAMES = synth_io::DEFAULT_FRAMES;
   float sampleRate = synth_io::DEFAULT_SAMPLE_RATE;
 
   VoicePool voicePool;
   ParamBinding paramBindings[ParamID::PARAM_COUNT];
+  param::smoothing::ParamSmoother paramSmoother;
 
-  // TODO(nico): this probably needs to live on heap
-  // since the number of frames won't be known at compile time
-  float poolBuffer[NUM_FRAMES];
+  // Runtime-sized buffers (owned; shared by copies of the engine)
+  buffers::EngineBuffers *buffers = nullptr;
 
   uint32_t noteCount = 0;
 
@@ -44,8 +48,22 @@ struct Engine {
   void processParamEvent(const ParamEvent &event);
   void processAudioBlock(float **outputBuffer, size_t numChannels,
                          size_t numFrames);
+
+  // Same render, written as [LRLRLR] (any numFrames)
+  void processAudioBlockInterleaved(float *output, size_t numChannels,
+                                    size_t numFrames);
 };
 
+// An invalid config.numFrames falls back to synth_io::DEFAULT_FRAMES
 Engine createEngine(const EngineConfig &config);
 
+// Stops render worker threads (if any) and frees the engine buffers; call
+// once the audio session stopped
+void disposeEngine(Engine &engine);
+
+// Resize the runtime-sized buffers for blocks of up to _maxFrames_.
+// NOT realtime safe, but safe while the audio thread is rendering.
+// Returns 0 on success
+int resizeEngineBuffers(Engine &engine, uint32_t maxFrames);
+
 } // namespace synth
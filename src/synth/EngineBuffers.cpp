@@ -0,0 +1,108 @@
+#include "EngineBuffers.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <thread>
+
+namespace synth::buffers {
+
+// ==== <Internal Helpers> ====
+namespace {
+// Round _numBytes_ up so the next buffer starts on an aligned address
+size_t alignedSize(size_t numBytes) {
+  return (numBytes + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+BufferArena *createArena(uint32_t maxFrames) {
+  size_t monoBytes = alignedSize(maxFrames * sizeof(float));
+
+  auto *arena = new BufferArena{};
+  arena->numBytes = monoBytes;
+  arena->maxFrames = maxFrames;
+  arena->memory =
+      ::operator new(arena->numBytes, std::align_val_t{ARENA_ALIGNMENT});
+
+  auto *bytes = static_cast<uint8_t *>(arena->memory);
+  arena->mono = reinterpret_cast<float *>(bytes);
+
+  for (uint32_t i = 0; i < maxFrames; i++)
+    arena->mono[i] = 0.0f;
+
+  return arena;
+}
+
+void destroyArena(BufferArena *arena) {
+  if (!arena)
+    return;
+
+  ::operator delete(arena->memory, std::align_val_t{ARENA_ALIGNMENT});
+  delete arena;
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+int validateFrames(uint32_t numFrames) {
+  if (numFrames == 0 || numFrames > MAX_FRAMES) {
+    printf("Invalid engine block size %u (1 - %u)\n", numFrames, MAX_FRAMES);
+    return 1;
+  }
+
+  return 0;
+}
+
+EngineBuffers *createEngineBuffers(uint32_t maxFrames) {
+  if (validateFrames(maxFrames))
+    return nullptr;
+
+  auto *buffers = new EngineBuffers{};
+  buffers->current.store(createArena(maxFrames));
+
+  return buffers;
+}
+
+void destroyEngineBuffers(EngineBuffers *buffers) {
+  if (!buffers)
+    return;
+
+  destroyArena(buffers->current.load());
+  delete buffers;
+}
+
+int resizeEngineBuffers(EngineBuffers &buffers, uint32_t maxFrames) {
+  if (validateFrames(maxFrames))
+    return 1;
+
+  BufferArena *previous = buffers.current.exchange(createArena(maxFrames));
+
+  // The audio thread may still be inside a callback with the old arena.
+  // Its next acquireArena sees the new one, so this wait is one callback
+  // at most (and none when audio is stopped)
+  while (buffers.inUse.load() == previous)
+    std::this_thread::yield();
+
+  destroyArena(previous);
+  return 0;
+}
+
+// ============ (Audio Thread) ============
+BufferArena *acquireArena(EngineBuffers &buffers) {
+  // Publish before use, then make sure a resize didn't retire it in
+  // between (seq_cst: the resizer's exchange and this re-check are ordered)
+  BufferArena *arena = buffers.current.load();
+  for (;;) {
+    buffers.inUse.store(arena);
+
+    BufferArena *latest = buffers.current.load();
+    if (latest == arena)
+      return arena;
+
+    arena = latest;
+  }
+}
+
+void releaseArena(EngineBuffers &buffers) { buffers.inUse.store(nullptr); }
+
+} // namespace synth::buffers
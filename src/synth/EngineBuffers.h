@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/* ==== Engine Buffers (runtime-sized) ====
+ * Buffers whose size depends on the host block size live in one aligned
+ * allocation (BufferArena), sized from EngineConfig::numFrames at
+ * createEngine time. Host blocks larger than the arena are rendered in
+ * arena-sized chunks, so any block size works; resizing just avoids the
+ * chunking.
+ *
+ * Resizing swaps in a new arena while the audio thread may be running:
+ *   - the audio thread publishes the arena it's using (acquireArena)
+ *   - resizeEngineBuffers retires the old arena only once the audio
+ *     thread isn't using it (it never waits on the resizer)
+ */
+namespace synth::buffers {
+inline constexpr uint32_t MAX_FRAMES = 16384;
+inline constexpr size_t ARENA_ALIGNMENT = 64; // cache line / widest SIMD
+
+struct BufferArena {
+  void *memory = nullptr;
+  size_t numBytes = 0;
+  uint32_t maxFrames = 0;
+
+  // ==== Carved out of _memory_ (each ARENA_ALIGNMENT aligned) ====
+  float *mono = nullptr; // engine render before interleaving (maxFrames)
+};
+
+// Owned by the Engine; shared by copies of it (see disposeEngine)
+struct EngineBuffers {
+  std::atomic<BufferArena *> current{nullptr};
+  std::atomic<BufferArena *> inUse{nullptr}; // set by the audio thread
+};
+
+// Returns 0 if _numFrames_ is a usable engine block size
+int validateFrames(uint32_t numFrames);
+
+// NOT realtime safe: call from setup code only
+EngineBuffers *createEngineBuffers(uint32_t maxFrames);
+void destroyEngineBuffers(EngineBuffers *buffers);
+
+/* Replace the arena with one sized for _maxFrames_.
+ * NOT realtime safe (allocates, may briefly wait for the audio thread to
+ * finish its current callback). Safe to call while audio is running.
+ * Returns 0 on success, non-zero if _maxFrames_ is invalid
+ */
+int resizeEngineBuffers(EngineBuffers &buffers, uint32_t maxFrames);
+
+// ============ (Audio Thread) ============
+// Pin the current arena for the duration of a callback (lock-free)
+BufferArena *acquireArena(EngineBuffers &buffers);
+void releaseArena(EngineBuffers &buffers);
+
+} // namespace synth::buffers
@@ -2,6 +2,7 @@
 
 #include "dsp/Envelope.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace synth::envelope {
@@ -14,6 +15,13 @@ void initEnvelope(Envelope &env, uint32_t voiceIndex, float sampleRate) {
   updateIncrements(env, sampleRate);
 }
 
+void moveVoice(Envelope &env, uint32_t from, uint32_t to) {
+  env.states[to] = env.states[from];
+  env.levels[to] = env.levels[from];
+  env.progress[to] = env.progress[from];
+  env.releaseStartLevels[to] = env.releaseStartLevels[from];
+}
+
 void triggerRelease(Envelope &env, uint32_t voiceIndex) {
   env.states[voiceIndex] = EnvelopeStatus::Release;
   env.releaseStartLevels[voiceIndex] = env.levels[voiceIndex];
@@ -34,4 +42,20 @@ float processEnvelope(Envelope &env, uint32_t voiceIndex) {
 
   return level;
 }
+
+void processEnvelopeBlock(Envelope &env, uint32_t voiceIndex, float *output,
+                          size_t numSamples) {
+  dsp::envelopes::processADSRBlock(
+      env.states[voiceIndex], env.levels[voiceIndex], env.progress[voiceIndex],
+      env.releaseStartLevels[voiceIndex], env.attackIncrement,
+      env.decayIncrement, env.releaseIncrement, env.sustainLevel, output,
+      numSamples);
+}
+
+float advanceEnvelope(Envelope &env, uint32_t voiceIndex, size_t numSamples) {
+  return dsp::envelopes::advanceADSR(
+      env.states[voiceIndex], env.levels[voiceIndex], env.progress[voiceIndex],
+      env.releaseStartLevels[voiceIndex], env.attackIncrement,
+      env.decayIncrement, env.releaseIncrement, env.sustainLevel, numSamples);
+}
 } // namespace synth::envelope
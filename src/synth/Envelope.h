@@ -4,6 +4,7 @@
 
 #include "dsp/Envelope.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace synth::envelope {
@@ -30,6 +31,9 @@ struct Envelope {
 
 void initEnvelope(Envelope &env, uint32_t voiceIndex, float sampleRate);
 
+// Copy voice _from_'s state into slot _to_ (voice compaction)
+void moveVoice(Envelope &env, uint32_t from, uint32_t to);
+
 void triggerRelease(Envelope &env, uint32_t voiceIndex);
 
 // Helper to recalculate increments when ADSR changes
@@ -37,4 +41,12 @@ void updateIncrements(Envelope &env, float sampleRate);
 
 float processEnvelope(Envelope &env, uint32_t voiceIndex);
 
+// Block version: writes numSamples levels into _output_
+void processEnvelopeBlock(Envelope &env, uint32_t voiceIndex, float *output,
+                          size_t numSamples);
+
+// Advances numSamples without writing them (block-rate mod sources);
+// returns the level at the end
+float advanceEnvelope(Envelope &env, uint32_t voiceIndex, size_t numSamples);
+
 } // namespace synth::envelope
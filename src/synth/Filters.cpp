@@ -1,5 +1,6 @@
 #include "Filters.h"
 
+#include "dsp/FastMath.h"
 #include "dsp/Math.h"
 
 #include <cmath>
@@ -11,6 +12,29 @@ float computeEffectiveCutoff(float baseCutoff, float cutoffModOctaves) {
   return baseCutoff * dsp::math::fastExp2(cutoffModOctaves);
 }
 
+// ==== <Modulation Helpers> ====
+namespace {
+// Cached coefficients unless cutoff/resonance are modulated
+SVFCoeffs modulatedSVFCoeffs(const SVFilter &filter, float cutoffHz,
+                             float resonance, float invSampleRate) {
+  bool isModulated = std::abs(filter.cutoff - cutoffHz) > 0.001f ||
+                     std::abs(filter.resonance - resonance) > 0.001f;
+
+  return isModulated ? dsp::filters::computeSVFCoeffs(
+                           cutoffHz, 0.5f + resonance * 20.0f, invSampleRate)
+                     : filter.coeffs;
+}
+
+// Cached coefficient unless cutoff is modulated
+float modulatedLadderCoeff(const LadderFilter &filter, float cutoffHz,
+                           float invSampleRate) {
+  return std::abs(filter.cutoff - cutoffHz) > 0.001f
+             ? 2.0f * dsp::math::fastSinPi(cutoffHz * invSampleRate)
+             : filter.coeff;
+}
+} // namespace
+// ==== </Modulation Helpers> ====
+
 // ==== SVF Helpers ====
 void enableSVFilter(SVFilter &filter, bool enable) {
   if (enable && !filter.enabled) {
@@ -24,6 +48,14 @@ void enableSVFilter(SVFilter &filter, bool enable) {
 
 void initSVFilter(SVFilter &filter, size_t voiceIndex) {
   filter.voiceStates[voiceIndex] = SVFState{};
+  filter.voiceCoeffs[voiceIndex] = filter.coeffs;
+  filter.prevVoiceCoeffs[voiceIndex] = filter.coeffs;
+}
+
+void moveSVFVoice(SVFilter &filter, size_t from, size_t to) {
+  filter.voiceStates[to] = filter.voiceStates[from];
+  filter.voiceCoeffs[to] = filter.voiceCoeffs[from];
+  filter.prevVoiceCoeffs[to] = filter.prevVoiceCoeffs[from];
 }
 
 void updateSVFCoefficients(SVFilter &filter, float invSampleRate) {
@@ -32,6 +64,14 @@ void updateSVFCoefficients(SVFilter &filter, float invSampleRate) {
       dsp::filters::computeSVFCoeffs(filter.cutoff, Q, invSampleRate);
 }
 
+void updateSVFVoiceCoeffs(SVFilter &filter, uint32_t voiceIndex,
+                          float cutoffHz, float resonance,
+                          float invSampleRate) {
+  filter.prevVoiceCoeffs[voiceIndex] = filter.voiceCoeffs[voiceIndex];
+  filter.voiceCoeffs[voiceIndex] =
+      modulatedSVFCoeffs(filter, cutoffHz, resonance, invSampleRate);
+}
+
 // Use when NOT passing modulation values (cutoff and/or resonance)
 float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex) {
   if (!filter.enabled)
@@ -54,19 +94,22 @@ float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex) {
   return out.lp;
 }
 
-// Use when passing modulation values (cutoff and/or resonance)
+// Use when passing modulation values (per-block voice coefficients)
 float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex,
-                      float cutoffHz, float resonance, float invSampleRate) {
+                      uint32_t sampleIndex, size_t numSamples) {
   if (!filter.enabled)
     return input;
 
-  bool isModulated = std::abs(filter.cutoff - cutoffHz) > 0.001f ||
-                     std::abs(filter.resonance - resonance) > 0.001f;
+  SVFCoeffs coeffs = filter.voiceCoeffs[voiceIndex];
 
-  SVFCoeffs coeffs =
-      isModulated ? dsp::filters::computeSVFCoeffs(
-                        cutoffHz, 0.5f + resonance * 20.0f, invSampleRate)
-                  : filter.coeffs;
+  if (filter.interpolateCoeffs) {
+    // Same ramp as dsp::filters::processSVFBlock (from, to]
+    const SVFCoeffs &from = filter.prevVoiceCoeffs[voiceIndex];
+    float t = static_cast<float>(sampleIndex + 1) /
+              static_cast<float>(numSamples);
+    coeffs = dsp::filters::computeSVFCoeffs(
+        from.g + (coeffs.g - from.g) * t, from.k + (coeffs.k - from.k) * t);
+  }
 
   SVFOutputs out =
       dsp::filters::processSVF(input, coeffs, filter.voiceStates[voiceIndex]);
@@ -85,6 +128,52 @@ float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex,
   return out.lp;
 }
 
+// Block version (in place), coefficients computed once per block
+void processSVFilterBlock(SVFilter &filter, float *buffer, size_t numSamples,
+                          uint32_t voiceIndex) {
+  if (!filter.enabled)
+    return;
+
+  // {lp, bp, hp} gains
+  float gains[3] = {1.0f, 0.0f, 0.0f};
+  switch (filter.mode) {
+  case SVFMode::MODE_COUNT:
+  case SVFMode::LP:
+    break;
+  case SVFMode::HP:
+    gains[0] = 0.0f;
+    gains[2] = 1.0f;
+    break;
+  case SVFMode::BP:
+    gains[0] = 0.0f;
+    gains[1] = 1.0f;
+    break;
+  case SVFMode::Notch:
+    gains[2] = 1.0f;
+    break;
+  }
+
+  if (filter.interpolateCoeffs)
+    dsp::filters::processSVFBlock(
+        buffer, numSamples, filter.prevVoiceCoeffs[voiceIndex],
+        filter.voiceCoeffs[voiceIndex], filter.voiceStates[voiceIndex],
+        gains[0], gains[1], gains[2]);
+  else
+    dsp::filters::processSVFBlock(buffer, numSamples,
+                                  filter.voiceCoeffs[voiceIndex],
+                                  filter.voiceStates[voiceIndex], gains[0],
+                                  gains[1], gains[2]);
+}
+
+bool settleSVFVoice(SVFilter &filter, uint32_t voiceIndex, float epsilon) {
+  SVFState &state = filter.voiceStates[voiceIndex];
+  if (std::abs(state.ic1) >= epsilon || std::abs(state.ic2) >= epsilon)
+    return false;
+
+  state = SVFState{};
+  return true;
+}
+
 // ==== Ladder Helpers ====
 void enableLadderFilter(LadderFilter &filter, bool enable) {
   if (enable && !filter.enabled) {
@@ -97,11 +186,34 @@ void enableLadderFilter(LadderFilter &filter, bool enable) {
 
 void initLadderFilter(LadderFilter &filter, size_t voiceIndex) {
   filter.voiceStates[voiceIndex] = LadderState{};
+  filter.voiceCoeffs[voiceIndex] = filter.coeff;
+  filter.prevVoiceCoeffs[voiceIndex] = filter.coeff;
+  filter.voiceResonances[voiceIndex] = filter.resonance * 4.0f;
+  filter.prevVoiceResonances[voiceIndex] = filter.resonance * 4.0f;
+}
+
+void moveLadderVoice(LadderFilter &filter, size_t from, size_t to) {
+  filter.voiceStates[to] = filter.voiceStates[from];
+  filter.voiceCoeffs[to] = filter.voiceCoeffs[from];
+  filter.prevVoiceCoeffs[to] = filter.prevVoiceCoeffs[from];
+  filter.voiceResonances[to] = filter.voiceResonances[from];
+  filter.prevVoiceResonances[to] = filter.prevVoiceResonances[from];
 }
 
 void updateLadderCoefficient(LadderFilter &filter, float invSampleRate) {
-  filter.coeff =
-      2.0f * std::sin(dsp::math::PI_F * filter.cutoff * invSampleRate);
+  filter.coeff = 2.0f * dsp::math::fastSinPi(filter.cutoff * invSampleRate);
+}
+
+void updateLadderVoiceCoeffs(LadderFilter &filter, uint32_t voiceIndex,
+                             float cutoffHz, float resonance,
+                             float invSampleRate) {
+  filter.prevVoiceCoeffs[voiceIndex] = filter.voiceCoeffs[voiceIndex];
+  filter.prevVoiceResonances[voiceIndex] = filter.voiceResonances[voiceIndex];
+
+  filter.voiceCoeffs[voiceIndex] =
+      modulatedLadderCoeff(filter, cutoffHz, invSampleRate);
+  filter.voiceResonances[voiceIndex] =
+      resonance * 4.0f; // map 0–1 to Ladder's 0–4 range
 }
 
 // Use when NOT passing modulation values (cutoff and/or resonance)
@@ -120,19 +232,25 @@ float processLadderFilter(LadderFilter &filter, float input,
                                            filter.voiceStates[voiceIndex]);
 }
 
-// Use when passing modulation values (cutoff and/or resonance)
+// Use when passing modulation values (per-block voice coefficients)
 float processLadderFilter(LadderFilter &filter, float input,
-                          uint32_t voiceIndex, float cutoffHz, float resonance,
-                          float invSampleRate) {
+                          uint32_t voiceIndex, uint32_t sampleIndex,
+                          size_t numSamples) {
   if (!filter.enabled)
     return input;
 
-  float coeff =
-      std::abs(filter.cutoff - cutoffHz) > 0.001f
-          ? 2.0f * std::sin(dsp::math::PI_F * cutoffHz * invSampleRate)
-          : filter.coeff;
+  float coeff = filter.voiceCoeffs[voiceIndex];
+  float res = filter.voiceResonances[voiceIndex];
 
-  float res = resonance * 4.0f; // map 0–1 to Ladder's 0–4 range
+  if (filter.interpolateCoeffs) {
+    // Same ramp as dsp::filters::processLadderBlock (from, to]
+    float fromCoeff = filter.prevVoiceCoeffs[voiceIndex];
+    float fromRes = filter.prevVoiceResonances[voiceIndex];
+    float t = static_cast<float>(sampleIndex + 1) /
+              static_cast<float>(numSamples);
+    coeff = fromCoeff + (coeff - fromCoeff) * t;
+    res = fromRes + (res - fromRes) * t;
+  }
 
   return (filter.drive > 1.001f)
              ? dsp::filters::processLadderNonlinear(
@@ -141,4 +259,48 @@ float processLadderFilter(LadderFilter &filter, float input,
              : dsp::filters::processLadder(input, coeff, res,
                                            filter.voiceStates[voiceIndex]);
 }
+
+// Block version (in place), coefficient computed once per block
+void processLadderFilterBlock(LadderFilter &filter, float *buffer,
+                              size_t numSamples, uint32_t voiceIndex) {
+  if (!filter.enabled)
+    return;
+
+  float coeff = filter.voiceCoeffs[voiceIndex];
+  float res = filter.voiceResonances[voiceIndex];
+  LadderState &state = filter.voiceStates[voiceIndex];
+
+  if (filter.interpolateCoeffs) {
+    float fromCoeff = filter.prevVoiceCoeffs[voiceIndex];
+    float fromRes = filter.prevVoiceResonances[voiceIndex];
+
+    if (filter.drive > 1.001f)
+      dsp::filters::processLadderNonlinearBlock(buffer, numSamples,
+                                                fromCoeff, coeff, fromRes,
+                                                res, filter.drive, state);
+    else
+      dsp::filters::processLadderBlock(buffer, numSamples, fromCoeff, coeff,
+                                       fromRes, res, state);
+    return;
+  }
+
+  if (filter.drive > 1.001f)
+    dsp::filters::processLadderNonlinearBlock(buffer, numSamples, coeff, res,
+                                              filter.drive, state);
+  else
+    dsp::filters::processLadderBlock(buffer, numSamples, coeff, res, state);
+}
+
+bool settleLadderVoice(LadderFilter &filter, uint32_t voiceIndex,
+                       float epsilon) {
+  LadderState &state = filter.voiceStates[voiceIndex];
+  for (float s : state.s) {
+    if (std::abs(s) >= epsilon)
+      return false;
+  }
+
+  state = LadderState{};
+  return true;
+}
+
 } // namespace synth::filters
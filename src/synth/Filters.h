@@ -21,12 +21,18 @@ struct SVFilter {
   // Cached coefficients (cold, recomputed on param change)
   SVFCoeffs coeffs{};
 
+  // Per-voice modulated coefficients, updated once per block
+  // (updateSVFVoiceCoeffs); prev = last block's, the interpolation start
+  SVFCoeffs voiceCoeffs[MAX_VOICES];
+  SVFCoeffs prevVoiceCoeffs[MAX_VOICES];
+
   // TODO(nico): need to define value ranges
   // Global settings (cold)
   SVFMode mode = SVFMode::LP;
   float cutoff = 1000.0f; // Hz
   float resonance = 0.5f; // 0.0–1.0 (mapped to Q internally)
   bool enabled = false;
+  bool interpolateCoeffs = false; // ramp g/k across each block
 };
 
 // ==== Ladder Filter (Moog Style) ====
@@ -37,6 +43,13 @@ struct LadderFilter {
   // frequency coefficient: 2 * sin(π * cutoff / sampleRate)
   float coeff = 0.0f;
 
+  // Per-voice modulated coefficient and resonance (0–4), updated once per
+  // block (updateLadderVoiceCoeffs); prev = last block's
+  float voiceCoeffs[MAX_VOICES];
+  float prevVoiceCoeffs[MAX_VOICES];
+  float voiceResonances[MAX_VOICES];
+  float prevVoiceResonances[MAX_VOICES];
+
   // TODO(nico): need to define value ranges
   // Global settings (cold data)
   float cutoff = 1000.0f; // Hz
@@ -44,6 +57,7 @@ struct LadderFilter {
   float drive =
       1.0f; // 1.0 = neutral, higher = more saturation (nonlinear path)
   bool enabled = false;
+  bool interpolateCoeffs = false; // ramp f/resonance across each block
 };
 
 // ==== FILTER HELPERS ====
@@ -52,27 +66,57 @@ float computeEffectiveCutoff(float baseCutoff, float cutoffModOctaves);
 
 // ==== SVF Helpers ====
 void initSVFilter(SVFilter &filter, size_t voiceIndex);
+void moveSVFVoice(SVFilter &filter, size_t from, size_t to);
 
 void updateSVFCoefficients(SVFilter &filter, float invSampleRate);
 
+// Once per block per voice, with the modulated cutoff/resonance
+// (cached coefficients are reused when unmodulated)
+void updateSVFVoiceCoeffs(SVFilter &filter, uint32_t voiceIndex,
+                          float cutoffHz, float resonance,
+                          float invSampleRate);
+
 // No modulation parameters
 float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex);
 
-// With modulation parameters
+// With the voice's per-block coefficients (_sampleIndex_ of _numSamples_
+// is only used when interpolating)
 float processSVFilter(SVFilter &filter, float input, uint32_t voiceIndex,
-                      float cutoffHz, float resonance, float invSampleRate);
+                      uint32_t sampleIndex, size_t numSamples);
+
+// Block version (in place), with the voice's per-block coefficients
+void processSVFilterBlock(SVFilter &filter, float *buffer, size_t numSamples,
+                          uint32_t voiceIndex);
+
+// True once the voice's state has rung out (below _epsilon_); it's then
+// cleared, so it stays at exactly 0 while the input is silent
+bool settleSVFVoice(SVFilter &filter, uint32_t voiceIndex, float epsilon);
 
 // ==== Ladder Helpers ====
 void initLadderFilter(LadderFilter &filter, size_t voiceIndex);
+void moveLadderVoice(LadderFilter &filter, size_t from, size_t to);
 
 void updateLadderCoefficient(LadderFilter &filter, float invSampleRate);
 
+// Once per block per voice, with the modulated cutoff/resonance
+void updateLadderVoiceCoeffs(LadderFilter &filter, uint32_t voiceIndex,
+                             float cutoffHz, float resonance,
+                             float invSampleRate);
+
 // No modulation parameters
 float processLadderFilter(LadderFilter &filter, float input,
                           uint32_t voiceIndex);
-// With modulation parameters
+// With the voice's per-block coefficient/resonance
 float processLadderFilter(LadderFilter &filter, float input,
-                          uint32_t voiceIndex, float cutoffHz, float resonance,
-                          float invSampleRate);
+                          uint32_t voiceIndex, uint32_t sampleIndex,
+                          size_t numSamples);
+
+// Block version (in place), with the voice's per-block coefficient/resonance
+void processLadderFilterBlock(LadderFilter &filter, float *buffer,
+                              size_t numSamples, uint32_t voiceIndex);
+
+// Same as settleSVFVoice
+bool settleLadderVoice(LadderFilter &filter, uint32_t voiceIndex,
+                       float epsilon);
 
 } // namespace synth::filters
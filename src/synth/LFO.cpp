@@ -0,0 +1,54 @@
+#include "LFO.h"
+
+#include "dsp/Modulation.h"
+
+#include <cstdint>
+
+namespace synth::lfo {
+
+// ==== <Internal Helpers> ====
+namespace {
+// Increments can exceed a whole cycle per block (fast LFOs, long blocks)
+float wrapPhase(float phase) {
+  while (phase >= 1.0f)
+    phase -= 1.0f;
+  return phase;
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+float getFrequency(const LFO &lfo, float tempoBpm) {
+  if (lfo.tempoSync && lfo.syncBeats > 0.0f)
+    return tempoBpm / (60.0f * lfo.syncBeats);
+
+  return lfo.rateHz;
+}
+
+void triggerLFO(LFO &lfo, uint32_t voiceIndex) {
+  if (!lfo.retrigger)
+    return;
+
+  if (lfo.perVoice)
+    lfo.phases[voiceIndex] = 0.0f;
+  else
+    lfo.globalPhase = 0.0f; // key sync: every new note restarts the cycle
+}
+
+void moveVoice(LFO &lfo, uint32_t from, uint32_t to) {
+  lfo.phases[to] = lfo.phases[from];
+}
+
+float processGlobalLFO(LFO &lfo, float phaseIncrement) {
+  float value = dsp::modulation::processLFO(lfo.globalPhase, lfo.waveform);
+  lfo.globalPhase = wrapPhase(lfo.globalPhase + phaseIncrement);
+  return value;
+}
+
+float processVoiceLFO(LFO &lfo, uint32_t voiceIndex, float phaseIncrement) {
+  float &phase = lfo.phases[voiceIndex];
+  float value = dsp::modulation::processLFO(phase, lfo.waveform);
+  phase = wrapPhase(phase + phaseIncrement);
+  return value;
+}
+
+} // namespace synth::lfo
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Types.h"
+
+#include "dsp/Waveforms.h"
+
+#include <cstdint>
+
+namespace synth::lfo {
+using WaveformType = dsp::waveforms::WaveformType;
+
+inline constexpr uint32_t NUM_LFOS = 3; // ModSrc LFO1 - LFO3
+
+inline constexpr float DEFAULT_TEMPO_BPM = 120.0f;
+
+/* Block-rate LFO, output -1.0 to +1.0
+ * Global (default): one phase shared by every voice, evaluated once per
+ * engine block no matter how many voices use it.
+ * Per-voice: each voice runs its own phase (e.g. retriggered per note).
+ */
+struct LFO {
+  // === Per-voice state (per-voice mode) ===
+  float phases[MAX_VOICES];
+
+  // === Global state ===
+  float globalPhase = 0.0f;
+
+  // === Settings (cold data) ===
+  WaveformType waveform = WaveformType::Sine;
+  float rateHz = 1.0f;
+
+  bool tempoSync = false;
+  float syncBeats = 1.0f; // cycle length in beats (0.25 = 1/16 note)
+
+  bool perVoice = false;
+  bool retrigger = false; // reset phase on note-on
+};
+
+// Cycles per second: rateHz, or one cycle per syncBeats when synced
+float getFrequency(const LFO &lfo, float tempoBpm);
+
+// Note-on for _voiceIndex_ (resets phases if retrigger is on)
+void triggerLFO(LFO &lfo, uint32_t voiceIndex);
+
+// Copy voice _from_'s phase into slot _to_ (voice compaction)
+void moveVoice(LFO &lfo, uint32_t from, uint32_t to);
+
+// Value at the start of the block, then advance by _phaseIncrement_
+// (cycles per block)
+float processGlobalLFO(LFO &lfo, float phaseIncrement);
+float processVoiceLFO(LFO &lfo, uint32_t voiceIndex, float phaseIncrement);
+
+} // namespace synth::lfo
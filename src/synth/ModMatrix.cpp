@@ -13,6 +13,7 @@ bool addRoute(ModMatrix &matrix, ModSrc src, ModDest dest, float amount) {
 
   matrix.routes[matrix.count] = {src, dest, amount};
   matrix.count++;
+  matrix.routesVersion++;
 
   return true;
 }
@@ -23,6 +24,7 @@ bool addRoute(ModMatrix &matrix, const ModRoute &route) {
 
   matrix.routes[matrix.count] = route;
   matrix.count++;
+  matrix.routesVersion++;
 
   return true;
 }
@@ -39,6 +41,7 @@ bool removeRoute(ModMatrix &matrix, uint8_t index) {
   matrix.routes[matrix.count].src = ModSrc::NoSrc;
   matrix.routes[matrix.count].dest = ModDest::NoDest;
   matrix.routes[matrix.count].amount = 0.0f;
+  matrix.routesVersion++;
 
   return true;
 }
@@ -51,9 +54,83 @@ bool clearRoutes(ModMatrix &matrix) {
   }
 
   matrix.count = 0;
+  matrix.routesVersion++;
   return true;
 }
 
+// ====== Compiled Routes =======
+void compileRoutes(ModMatrix &matrix) {
+  if (matrix.program.version == matrix.routesVersion)
+    return;
+
+  ModProgram program{};
+  uint8_t numTerms = 0;
+
+  // Grouped by destination, route order kept within a destination
+  for (int d = 1; d < ModDest::DEST_COUNT; d++) {
+    program.termStarts[program.numDests] = numTerms;
+
+    for (uint8_t r = 0; r < matrix.count; r++) {
+      const ModRoute &route = matrix.routes[r];
+      if (route.dest != d || route.src == ModSrc::NoSrc)
+        continue;
+
+      program.termSrcs[numTerms] = route.src;
+      program.termAmounts[numTerms] = route.amount;
+      program.isSrcUsed[route.src] = true;
+      numTerms++;
+    }
+
+    uint8_t termCount =
+        static_cast<uint8_t>(numTerms - program.termStarts[program.numDests]);
+    if (termCount == 0)
+      continue;
+
+    program.termCounts[program.numDests] = termCount;
+    program.dests[program.numDests++] = static_cast<ModDest>(d);
+    program.isDestRouted[d] = true;
+  }
+
+  // Nothing writes an unrouted destination, so zero it once here
+  for (int d = 1; d < ModDest::DEST_COUNT; d++) {
+    if (!matrix.program.isDestRouted[d] || program.isDestRouted[d])
+      continue;
+
+    for (uint32_t v = 0; v < MAX_VOICES; v++) {
+      matrix.destValues[d][v] = 0.0f;
+      matrix.prevDestValues[d][v] = 0.0f;
+      matrix.destStepValues[d][v] = 0.0f;
+    }
+  }
+
+  program.version = matrix.routesVersion;
+  matrix.program = program;
+}
+
+void evaluateRoutes(ModMatrix &matrix, const ModSrcValues &srcValues,
+                    const uint32_t *voiceIndices, uint32_t numVoices) {
+  const ModProgram &program = matrix.program;
+
+  for (uint8_t k = 0; k < program.numDests; k++) {
+    float sums[MAX_VOICES] = {};
+
+    // Each term is one loop across voices
+    uint8_t end = static_cast<uint8_t>(program.termStarts[k] +
+                                       program.termCounts[k]);
+    for (uint8_t t = program.termStarts[k]; t < end; t++) {
+      const float *src = srcValues[program.termSrcs[t]];
+      float amount = program.termAmounts[t];
+
+      for (uint32_t i = 0; i < numVoices; i++)
+        sums[i] += src[i] * amount;
+    }
+
+    float *dest = matrix.destValues[program.dests[k]];
+    for (uint32_t i = 0; i < numVoices; i++)
+      dest[voiceIndices[i]] = sums[i];
+  }
+}
+
 // ====== Steps Management =======
 void clearModDestSteps(ModMatrix &matrix) {
   for (uint8_t d = 0; d < ModDest::DEST_COUNT; d++) {
@@ -71,6 +148,14 @@ void setModDestStep(ModMatrix &matrix, ModDest dest, uint32_t voiceIndex,
       invNumSamples;
 }
 
+void moveVoice(ModMatrix &matrix, uint32_t from, uint32_t to) {
+  for (uint8_t d = 0; d < ModDest::DEST_COUNT; d++) {
+    matrix.destValues[d][to] = matrix.destValues[d][from];
+    matrix.prevDestValues[d][to] = matrix.prevDestValues[d][from];
+    matrix.destStepValues[d][to] = matrix.destStepValues[d][from];
+  }
+}
+
 // ==========================
 // Parsing Helpers
 // ==========================
@@ -64,10 +64,38 @@ struct ModRoute {
   float amount = 0.0f;
 };
 
+// Block-rate source values, one row per source (dense over active voices)
+using ModSrcValues = float[ModSrc::SRC_COUNT][MAX_VOICES];
+
+/* ==== Compiled routes ====
+ * The route list flattened per destination: only routed destinations,
+ * each with its (src, amount) terms in route order. Rebuilt by the audio
+ * thread whenever the routes changed (see compileRoutes), so the per-block
+ * pass never scans routes or touches unrouted destinations.
+ */
+struct ModProgram {
+  ModDest dests[ModDest::DEST_COUNT]; // routed destinations
+  uint8_t numDests = 0;
+
+  uint8_t termStarts[ModDest::DEST_COUNT]; // into termSrcs/termAmounts
+  uint8_t termCounts[ModDest::DEST_COUNT];
+  ModSrc termSrcs[MAX_MOD_ROUTES];
+  float termAmounts[MAX_MOD_ROUTES];
+
+  bool isDestRouted[ModDest::DEST_COUNT] = {};
+  bool isSrcUsed[ModSrc::SRC_COUNT] = {};
+
+  uint32_t version = 0; // routesVersion it was built from
+};
+
 struct ModMatrix {
   ModRoute routes[MAX_MOD_ROUTES];
   uint8_t count = 0;
 
+  // Bumped by every route change; the program catches up lazily
+  uint32_t routesVersion = 0;
+  ModProgram program;
+
   // engine block-rate output of pre-pass
   ModDest2D destValues = {};
 
@@ -84,11 +112,25 @@ bool addRoute(ModMatrix &matrix, const ModRoute &route);
 bool removeRoute(ModMatrix &matrix, uint8_t index);
 bool clearRoutes(ModMatrix &matrix);
 
+// ============ (Audio Thread) ============
+// Rebuild the program if the routes changed since it was built.
+// Destinations that lost their last route are reset to 0 for every voice
+void compileRoutes(ModMatrix &matrix);
+
+// destValues[dest][voice] = sum of amount * source, for routed
+// destinations only (unrouted ones stay 0). _srcValues_ rows are indexed
+// like _voiceIndices_
+void evaluateRoutes(ModMatrix &matrix, const ModSrcValues &srcValues,
+                    const uint32_t *voiceIndices, uint32_t numVoices);
+
 void clearPrevModDests(ModMatrix &matrix);
 void clearModDestSteps(ModMatrix &matrix);
 void setModDestStep(ModMatrix &matrix, ModDest dest, uint32_t voiceIndex,
                     float invNumSamples);
 
+// Copy voice _from_'s dest values into slot _to_ (voice compaction)
+void moveVoice(ModMatrix &matrix, uint32_t from, uint32_t to);
+
 // ==== Parsing Helpers ====
 struct ModSrcMapping {
   const char *name;
@@ -0,0 +1,81 @@
+#include "Noise.h"
+
+#include "dsp/Noise.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace synth::noise {
+
+// ==== <Internal Helpers> ====
+namespace {
+// Mod values come from their own stream so they don't depend on whether
+// (or how much) noise is being rendered
+constexpr uint32_t MOD_STREAM = 0x6D6F6473u;
+} // namespace
+// ==== </Internal Helpers> ====
+
+void initNoise(NoiseGenerator &noise, uint32_t voiceIndex,
+               uint32_t noteOnTime) {
+  noise.keys[voiceIndex] = dsp::noise::streamKey(noise.seed, noteOnTime);
+  noise.counters[voiceIndex] = 0;
+  noise.modCounters[voiceIndex] = 0;
+
+  noise.pinkB0[voiceIndex] = 0.0f;
+  noise.pinkB1[voiceIndex] = 0.0f;
+  noise.pinkB2[voiceIndex] = 0.0f;
+}
+
+void moveVoice(NoiseGenerator &noise, uint32_t from, uint32_t to) {
+  noise.keys[to] = noise.keys[from];
+  noise.counters[to] = noise.counters[from];
+  noise.modCounters[to] = noise.modCounters[from];
+
+  noise.pinkB0[to] = noise.pinkB0[from];
+  noise.pinkB1[to] = noise.pinkB1[from];
+  noise.pinkB2[to] = noise.pinkB2[from];
+}
+
+float processNoise(NoiseGenerator &noise, uint32_t voiceIndex, float gain) {
+  float sample = dsp::noise::white(noise.keys[voiceIndex],
+                                   noise.counters[voiceIndex]++);
+
+  if (noise.type == NoiseType::Pink)
+    sample = dsp::noise::pink(noise.pinkB0[voiceIndex],
+                              noise.pinkB1[voiceIndex],
+                              noise.pinkB2[voiceIndex], sample);
+
+  return sample * gain;
+}
+
+void processNoiseBlock(NoiseGenerator &noise, uint32_t voiceIndex, float gain,
+                       float *output, size_t numSamples) {
+  float buffer[ENGINE_BLOCK_SIZE];
+  uint32_t key = noise.keys[voiceIndex];
+  uint32_t counter = noise.counters[voiceIndex];
+
+  if (noise.type == NoiseType::Pink) {
+    dsp::noise::PinkState state{noise.pinkB0[voiceIndex],
+                                noise.pinkB1[voiceIndex],
+                                noise.pinkB2[voiceIndex]};
+    dsp::noise::pinkBlock(key, counter, state, buffer, numSamples);
+
+    noise.pinkB0[voiceIndex] = state.b0;
+    noise.pinkB1[voiceIndex] = state.b1;
+    noise.pinkB2[voiceIndex] = state.b2;
+  } else {
+    dsp::noise::whiteBlock(key, counter, buffer, numSamples);
+  }
+
+  for (size_t i = 0; i < numSamples; i++)
+    output[i] += buffer[i] * gain;
+
+  noise.counters[voiceIndex] = counter + static_cast<uint32_t>(numSamples);
+}
+
+float processNoiseMod(NoiseGenerator &noise, uint32_t voiceIndex) {
+  return dsp::noise::white(noise.keys[voiceIndex] ^ MOD_STREAM,
+                           noise.modCounters[voiceIndex]++);
+}
+
+} // namespace synth::noise
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace synth::noise {
+enum class NoiseType : uint8_t { White, Pink, NOISE_TYPE_COUNT };
+
+inline constexpr uint32_t DEFAULT_NOISE_SEED = 0x5EED1234u;
+
+/* Noise source: fifth audio source per voice and the Noise mod source.
+ * Every note gets its own stream (keyed by seed + note-on count), so
+ * voices share no state and a render replays exactly for a given seed.
+ */
+struct NoiseGenerator {
+  // === Per-voice state (hot data) ===
+  uint32_t keys[MAX_VOICES];        // stream key (per note)
+  uint32_t counters[MAX_VOICES];    // next audio sample of the stream
+  uint32_t modCounters[MAX_VOICES]; // next mod value (per block)
+  float pinkB0[MAX_VOICES];
+  float pinkB1[MAX_VOICES];
+  float pinkB2[MAX_VOICES];
+
+  // === Global settings (cold data) ===
+  NoiseType type = NoiseType::White;
+  float mixLevel = 1.0f; // 0.0-4.0, like the oscillators
+  bool enabled = false;
+
+  uint32_t seed = DEFAULT_NOISE_SEED;
+};
+
+void initNoise(NoiseGenerator &noise, uint32_t voiceIndex,
+               uint32_t noteOnTime);
+
+// Copy voice _from_'s stream into slot _to_ (voice compaction)
+void moveVoice(NoiseGenerator &noise, uint32_t from, uint32_t to);
+
+// One noise sample * _gain_ (per-sample render path)
+float processNoise(NoiseGenerator &noise, uint32_t voiceIndex, float gain);
+
+// Block version: ADDS noise * _gain_ into _output_
+void processNoiseBlock(NoiseGenerator &noise, uint32_t voiceIndex, float gain,
+                       float *output, size_t numSamples);
+
+// Mod source: a new random value (-1.0 to +1.0) per call, i.e. per block
+float processNoiseMod(NoiseGenerator &noise, uint32_t voiceIndex);
+
+} // namespace synth::noise
@@ -3,7 +3,10 @@
 #include "synth/ParamRanges.h"
 #include "utils/Utils.h"
 
+#include "dsp/Math.h"
+
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 namespace synth::oscillator {
@@ -30,6 +33,11 @@ void initOscillator(Oscillator &osc, uint32_t voiceIndex, uint8_t midiNote,
   osc.phaseIncrements[voiceIndex] = freq / sampleRate;
 }
 
+void moveVoice(Oscillator &osc, uint32_t from, uint32_t to) {
+  osc.phases[to] = osc.phases[from];
+  osc.phaseIncrements[to] = osc.phaseIncrements[from];
+}
+
 // Helper for updating global settings
 void updateConfig(Oscillator &osc, const OscConfig &config) {
   if (osc.detuneAmount != config.detuneAmount)
@@ -81,6 +89,10 @@ void setDetuneAmount(Oscillator &osc, float newDetuneAmount) {
 
 void toggleEnabled(Oscillator &osc, bool isEnabled) { osc.enabled = isEnabled; }
 
+const Wavetable &getWavetable(const Oscillator &osc) {
+  return dsp::wavetable::getBuiltinTable(osc.waveform);
+}
+
 // =================================
 // Processing
 // =================================
@@ -95,8 +107,8 @@ void incrementPhase(Oscillator &osc, uint32_t voiceIndex) {
 // Use this if NOT passing pitch and/or mix modulation
 float processOscillator(Oscillator &osc, uint32_t voiceIndex) {
   float sample =
-      dsp::waveforms::processWaveform(osc.waveform, osc.phases[voiceIndex],
-                                      osc.phaseIncrements[voiceIndex]) *
+      dsp::wavetable::lookup(getWavetable(osc), osc.phases[voiceIndex],
+                             osc.phaseIncrements[voiceIndex]) *
       osc.mixLevel;
 
   incrementPhase(osc, voiceIndex);
@@ -108,8 +120,9 @@ float processOscillator(Oscillator &osc, uint32_t voiceIndex) {
 // NOTE(nico): values are expected to be calculated by caller
 float processOscillator(Oscillator &osc, uint32_t voiceIndex,
                         float phaseIncrement, float mixLevel) {
-  float sample = dsp::waveforms::processWaveform(
-                     osc.waveform, osc.phases[voiceIndex], phaseIncrement) *
+  float sample = dsp::wavetable::lookup(getWavetable(osc),
+                                        osc.phases[voiceIndex],
+                                        phaseIncrement) *
                  param::ranges::osc::clampMixLevel(mixLevel);
 
   // Advance using the modulated increment, not the stored one
@@ -120,4 +133,21 @@ float processOscillator(Oscillator &osc, uint32_t voiceIndex,
   return sample;
 }
 
+void processOscillatorBlock(Oscillator &osc, uint32_t voiceIndex,
+                            float pitchStart, float pitchStep, float mixLevel,
+                            float *output, size_t numSamples) {
+  float phaseIncrements[ENGINE_BLOCK_SIZE];
+
+  dsp::math::semitonesToFreqRatios(pitchStart, pitchStep, phaseIncrements,
+                                   numSamples);
+
+  float baseIncrement = osc.phaseIncrements[voiceIndex];
+  for (size_t i = 0; i < numSamples; i++)
+    phaseIncrements[i] *= baseIncrement;
+
+  dsp::wavetable::processWavetableBlock(
+      getWavetable(osc), osc.phases[voiceIndex], phaseIncrements,
+      param::ranges::osc::clampMixLevel(mixLevel), output, numSamples);
+}
+
 } // namespace synth::oscillator
@@ -2,12 +2,15 @@
 
 #include "Types.h"
 
+#include "dsp/Wavetable.h"
 #include "dsp/Waveforms.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace synth::oscillator {
 using WaveformType = dsp::waveforms::WaveformType;
+using Wavetable = dsp::wavetable::Wavetable;
 
 struct OscConfig {
   WaveformType waveform = WaveformType::Sine;
@@ -39,6 +42,12 @@ void setOctiveOffset(Oscillator &osc, int8_t newOffest);
 void setDetuneAmount(Oscillator &osc, float newDetuneAmount);
 void toggleEnabled(Oscillator &osc, bool isEnabled);
 
+// Built-in table for the oscillator's current waveform
+const Wavetable &getWavetable(const Oscillator &osc);
+
+// Copy voice _from_'s state into slot _to_ (voice compaction)
+void moveVoice(Oscillator &osc, uint32_t from, uint32_t to);
+
 void initOscillator(Oscillator &osc, uint32_t voiceIndex, uint8_t midiNote,
                     float sampleRate);
 
@@ -51,4 +60,12 @@ float processOscillator(Oscillator &osc, uint32_t voiceIndex);
 float processOscillator(Oscillator &osc, uint32_t voiceIndex,
                         float phaseIncrement, float mixLevel);
 
+/* Block version: ADDS numSamples into _output_
+ * Pitch mod is ramped from pitchStart by pitchStep semitones per sample
+ * numSamples must be <= ENGINE_BLOCK_SIZE
+ */
+void processOscillatorBlock(Oscillator &osc, uint32_t voiceIndex,
+                            float pitchStart, float pitchStep, float mixLevel,
+                            float *output, size_t numSamples);
+
 } // namespace synth::oscillator
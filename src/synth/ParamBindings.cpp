@@ -2,12 +2,14 @@
 
 #include "Engine.h"
 #include "Envelope.h"
+#include "ParamSmoothing.h"
 #include "synth/Filters.h"
 #include "synth/ParamRanges.h"
 
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <string>
 
 namespace synth::param::bindings {
 
@@ -59,6 +61,15 @@ ParamBinding makeParamBinding(SVFMode *ptr, int min, int max) {
   return binding;
 }
 
+ParamBinding makeParamBinding(NoiseType *ptr, int min, int max) {
+  ParamBinding binding;
+  binding.noiseTypePtr = ptr;
+  binding.type = NOISE_TYPE;
+  binding.min = static_cast<float>(min);
+  binding.max = static_cast<float>(max);
+  return binding;
+}
+
 // Filter Bindings
 void bindSVFilter(ParamBinding *bindings, ParamID baseId,
                   filters::SVFilter &filter) {
@@ -109,6 +120,19 @@ void bindOscillator(ParamBinding *bindings, ParamID baseId,
   bindings[baseId + 4] = makeParamBinding(&osc.enabled);
 }
 
+// Noise Bindings
+void bindNoise(ParamBinding *bindings, ParamID baseId,
+               noise::NoiseGenerator &noise) {
+  bindings[baseId + 0] =
+      makeParamBinding(&noise.type, ranges::noise::NOISE_TYPE_MIN,
+                       ranges::noise::NOISE_TYPE_MAX);
+
+  bindings[baseId + 1] = makeParamBinding(
+      &noise.mixLevel, ranges::osc::MIX_LEVEL_MIN, ranges::osc::MIX_LEVEL_MAX);
+
+  bindings[baseId + 2] = makeParamBinding(&noise.enabled);
+}
+
 // Envelope Bindings
 void bindEnvelope(ParamBinding *bindings, ParamID baseId,
                   envelope::Envelope &env) {
@@ -125,6 +149,25 @@ void bindEnvelope(ParamBinding *bindings, ParamID baseId,
                                           ranges::env::TIME_MAX);
 }
 
+// LFO Bindings
+void bindLFO(ParamBinding *bindings, ParamID baseId, lfo::LFO &lfo) {
+  bindings[baseId + 0] = makeParamBinding(
+      &lfo.waveform, ranges::osc::WAVEFORM_MIN, ranges::osc::WAVEFORM_MAX);
+
+  bindings[baseId + 1] = makeParamBinding(&lfo.rateHz, ranges::lfo::RATE_MIN,
+                                          ranges::lfo::RATE_MAX);
+
+  bindings[baseId + 2] = makeParamBinding(&lfo.tempoSync);
+
+  bindings[baseId + 3] =
+      makeParamBinding(&lfo.syncBeats, ranges::lfo::SYNC_BEATS_MIN,
+                       ranges::lfo::SYNC_BEATS_MAX);
+
+  bindings[baseId + 4] = makeParamBinding(&lfo.perVoice);
+
+  bindings[baseId + 5] = makeParamBinding(&lfo.retrigger);
+}
+
 // Handle updates to params with derived values
 void onParamUpdate(Engine &engine, ParamID id) {
   switch (id) {
@@ -173,6 +216,9 @@ void initParamBindings(Engine &engine) {
   bindOscillator(engine.paramBindings, SUB_OSC_WAVEFORM,
                  engine.voicePool.subOsc);
 
+  // Noise - 3 params
+  bindNoise(engine.paramBindings, NOISE_COLOR, engine.voicePool.noise);
+
   // Envelopes
   bindEnvelope(engine.paramBindings, AMP_ENV_ATTACK, engine.voicePool.ampEnv);
   bindEnvelope(engine.paramBindings, FILTER_ENV_ATTACK,
@@ -183,10 +229,18 @@ void initParamBindings(Engine &engine) {
   bindLadderFilter(engine.paramBindings, LADDER_ENABLED,
                    engine.voicePool.ladder);
 
+  // LFOs - 6 params each
+  bindLFO(engine.paramBindings, LFO1_WAVEFORM, engine.voicePool.lfos[0]);
+  bindLFO(engine.paramBindings, LFO2_WAVEFORM, engine.voicePool.lfos[1]);
+  bindLFO(engine.paramBindings, LFO3_WAVEFORM, engine.voicePool.lfos[2]);
+
   // Voice Pool
   engine.paramBindings[MASTER_GAIN] = makeParamBinding(
       &engine.voicePool.masterGain, ranges::global::MASTER_GAIN_MIN,
       ranges::global::MASTER_GAIN_MAX);
+  engine.paramBindings[MASTER_TEMPO] =
+      makeParamBinding(&engine.voicePool.tempoBpm, ranges::global::TEMPO_MIN,
+                       ranges::global::TEMPO_MAX);
 }
 
 // ==== Param Getter/Setter ====
@@ -205,7 +259,9 @@ float getParamValueByID(const Engine &engine, ParamID id,
   // Read the current value based on type
   switch (binding.type) {
   case FLOAT:
-    value = *binding.floatPtr;
+    // A gliding param reports where it's headed
+    value = engine.paramSmoother.isMoving[id] ? engine.paramSmoother.target[id]
+                                              : *binding.floatPtr;
     break;
 
   case INT8:
@@ -223,6 +279,10 @@ float getParamValueByID(const Engine &engine, ParamID id,
   case WAVEFORM:
     value = static_cast<float>(static_cast<int>(*binding.waveformPtr));
     break;
+
+  case NOISE_TYPE:
+    value = static_cast<float>(static_cast<int>(*binding.noiseTypePtr));
+    break;
   }
 
   if (valueFormat == ParamValueFormat::DENORMALIZED)
@@ -258,6 +318,13 @@ void setParamValueByID(Engine &engine, ParamID id, float value,
 
   switch (binding.type) {
   case FLOAT:
+    // Glide while voices are sounding; with nothing to click, just jump
+    if (engine.voicePool.activeCount > 0 &&
+        smoothing::setTarget(engine.paramSmoother, id, *binding.floatPtr,
+                             value))
+      return;
+
+    smoothing::cancel(engine.paramSmoother, id);
     *binding.floatPtr = value;
     break;
 
@@ -278,12 +345,30 @@ void setParamValueByID(Engine &engine, ParamID id, float value,
     *binding.waveformPtr =
         static_cast<WaveformType>(static_cast<int>(std::round(value)));
     break;
+
+  case NOISE_TYPE:
+    *binding.noiseTypePtr =
+        static_cast<NoiseType>(static_cast<int>(std::round(value)));
+    break;
   }
 
   // Handle post-update logic for params with derived values (i.e. Envelopes)
   onParamUpdate(engine, id);
 }
 
+void advanceParamSmoothing(Engine &engine, uint32_t numSamples) {
+  if (engine.paramSmoother.movingCount == 0)
+    return;
+
+  ParamID updatedIds[PARAM_COUNT];
+  uint32_t updatedCount =
+      smoothing::advance(engine.paramSmoother, engine.paramBindings,
+                         numSamples, updatedIds);
+
+  for (uint32_t i = 0; i < updatedCount; i++)
+    onParamUpdate(engine, updatedIds[i]);
+}
+
 // String → ParamID (for parsing 'set' commands)
 ParamMapping findParamByName(const char *name) {
   for (const auto &mapping : PARAM_NAMES) {
@@ -355,4 +440,63 @@ WaveformType getWaveformType(const char *inputValue) {
   // default to Sine
   return WaveformType::Sine;
 }
+
+NoiseType getNoiseType(const char *inputValue) {
+  if (strcasecmp(inputValue, "pink") == 0)
+    return NoiseType::Pink;
+
+  // default to White
+  return NoiseType::White;
+}
+
+float parseParamValue(ParamValueType type, std::istringstream &iss) {
+  float paramValue = 0.0f;
+
+  switch (type) {
+  // Set Oscillator Waveform
+  case ParamValueType::WAVEFORM: {
+    std::string value;
+    iss >> value;
+
+    auto waveformType = getWaveformType(value.c_str());
+    paramValue = static_cast<float>(waveformType);
+
+  } break;
+
+  // Enable/Disable Item
+  case ParamValueType::BOOL: {
+    std::string value;
+    iss >> value;
+
+    paramValue = strcasecmp(value.c_str(), "true") == 0 ? 1.0f : 0.0f;
+
+  } break;
+
+  // Set SVF Mode
+  case ParamValueType::FILTER_MODE: {
+    std::string value;
+    iss >> value;
+
+    auto filterMode = getSVFModeType(value.c_str());
+    paramValue = static_cast<float>(filterMode);
+
+  } break;
+
+  // Set Noise Color
+  case ParamValueType::NOISE_TYPE: {
+    std::string value;
+    iss >> value;
+
+    auto noiseType = getNoiseType(value.c_str());
+    paramValue = static_cast<float>(noiseType);
+
+  } break;
+
+  // Treat all other params values as floats (denormalized)
+  default:
+    iss >> paramValue;
+  }
+
+  return paramValue;
+}
 } // namespace synth::param::bindings
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "synth/Filters.h"
+#include "synth/Noise.h"
 #include "synth/Oscillator.h"
 #include <cstddef>
+#include <cstdint>
+#include <sstream>
 
 namespace synth {
 struct Engine;
@@ -11,6 +14,7 @@ struct Engine;
 namespace synth::param::bindings {
 using SVFMode = filters::SVFMode;
 using WaveformType = oscillator::WaveformType;
+using NoiseType = noise::NoiseType;
 
 enum ParamID {
   // Oscillator 1
@@ -41,6 +45,11 @@ enum ParamID {
   SUB_OSC_OCTAVE_OFFSET,
   SUB_OSC_ENABLED,
 
+  // Noise
+  NOISE_COLOR,
+  NOISE_MIX_LEVEL,
+  NOISE_ENABLED,
+
   // Amp Envelope
   AMP_ENV_ATTACK,
   AMP_ENV_DECAY,
@@ -65,7 +74,32 @@ enum ParamID {
   LADDER_RESONANCE,
   LADDER_DRIVE,
 
+  // LFO 1
+  LFO1_WAVEFORM,
+  LFO1_RATE,
+  LFO1_SYNC,
+  LFO1_SYNC_BEATS,
+  LFO1_PER_VOICE,
+  LFO1_RETRIGGER,
+
+  // LFO 2
+  LFO2_WAVEFORM,
+  LFO2_RATE,
+  LFO2_SYNC,
+  LFO2_SYNC_BEATS,
+  LFO2_PER_VOICE,
+  LFO2_RETRIGGER,
+
+  // LFO 3
+  LFO3_WAVEFORM,
+  LFO3_RATE,
+  LFO3_SYNC,
+  LFO3_SYNC_BEATS,
+  LFO3_PER_VOICE,
+  LFO3_RETRIGGER,
+
   MASTER_GAIN,
+  MASTER_TEMPO,
 
   PARAM_COUNT,
 };
@@ -75,7 +109,7 @@ enum ParamValueFormat {
   DENORMALIZED,
 };
 
-enum ParamValueType { FLOAT, INT8, BOOL, WAVEFORM, FILTER_MODE };
+enum ParamValueType { FLOAT, INT8, BOOL, WAVEFORM, FILTER_MODE, NOISE_TYPE };
 
 struct ParamBinding {
   union {
@@ -84,6 +118,7 @@ struct ParamBinding {
     bool *boolPtr;
     SVFMode *svfModePtr;
     WaveformType *waveformPtr;
+    NoiseType *noiseTypePtr;
   };
   ParamValueType type;
   float min, max;
@@ -122,6 +157,10 @@ constexpr ParamMapping PARAM_NAMES[] = {
     {SUB_OSC_OCTAVE_OFFSET, "subOsc.octave", ParamValueType::INT8},
     {SUB_OSC_ENABLED, "subOsc.enabled", ParamValueType::BOOL},
 
+    {NOISE_COLOR, "noise.color", ParamValueType::NOISE_TYPE},
+    {NOISE_MIX_LEVEL, "noise.mixLevel", ParamValueType::FLOAT},
+    {NOISE_ENABLED, "noise.enabled", ParamValueType::BOOL},
+
     {AMP_ENV_ATTACK, "ampEnv.attack", ParamValueType::FLOAT},
     {AMP_ENV_DECAY, "ampEnv.decay", ParamValueType::FLOAT},
     {AMP_ENV_SUSTAIN_LEVEL, "ampEnv.sustain", ParamValueType::FLOAT},
@@ -142,7 +181,29 @@ constexpr ParamMapping PARAM_NAMES[] = {
     {FILTER_ENV_SUSTAIN_LEVEL, "filterEnv.sustain", ParamValueType::FLOAT},
     {FILTER_ENV_RELEASE, "filterEnv.release", ParamValueType::FLOAT},
 
+    {LFO1_WAVEFORM, "lfo1.waveform", ParamValueType::WAVEFORM},
+    {LFO1_RATE, "lfo1.rate", ParamValueType::FLOAT},
+    {LFO1_SYNC, "lfo1.sync", ParamValueType::BOOL},
+    {LFO1_SYNC_BEATS, "lfo1.beats", ParamValueType::FLOAT},
+    {LFO1_PER_VOICE, "lfo1.perVoice", ParamValueType::BOOL},
+    {LFO1_RETRIGGER, "lfo1.retrigger", ParamValueType::BOOL},
+
+    {LFO2_WAVEFORM, "lfo2.waveform", ParamValueType::WAVEFORM},
+    {LFO2_RATE, "lfo2.rate", ParamValueType::FLOAT},
+    {LFO2_SYNC, "lfo2.sync", ParamValueType::BOOL},
+    {LFO2_SYNC_BEATS, "lfo2.beats", ParamValueType::FLOAT},
+    {LFO2_PER_VOICE, "lfo2.perVoice", ParamValueType::BOOL},
+    {LFO2_RETRIGGER, "lfo2.retrigger", ParamValueType::BOOL},
+
+    {LFO3_WAVEFORM, "lfo3.waveform", ParamValueType::WAVEFORM},
+    {LFO3_RATE, "lfo3.rate", ParamValueType::FLOAT},
+    {LFO3_SYNC, "lfo3.sync", ParamValueType::BOOL},
+    {LFO3_SYNC_BEATS, "lfo3.beats", ParamValueType::FLOAT},
+    {LFO3_PER_VOICE, "lfo3.perVoice", ParamValueType::BOOL},
+    {LFO3_RETRIGGER, "lfo3.retrigger", ParamValueType::BOOL},
+
     {MASTER_GAIN, "master.gain", ParamValueType::FLOAT},
+    {MASTER_TEMPO, "master.tempo", ParamValueType::FLOAT},
 
 };
 
@@ -165,6 +226,10 @@ void setParamValueByID(
     Engine &engine, ParamID id, float value,
     ParamValueFormat valueFormat = ParamValueFormat::DENORMALIZED);
 
+// ============ (Audio Thread) ============
+// Glide smoothed params by one engine block (see ParamSmoothing.h)
+void advanceParamSmoothing(Engine &engine, uint32_t numSamples);
+
 // String parsing helpers
 ParamMapping findParamByName(const char *name);
 const char *getParamName(ParamID id);
@@ -172,5 +237,10 @@ const char *getParamName(ParamID id);
 // Helpers for dealing with param values that are strings
 SVFMode getSVFModeType(const char *inputValue);
 WaveformType getWaveformType(const char *inputValue);
+NoiseType getNoiseType(const char *inputValue);
+
+// Read the next value token for a param type (denormalized)
+// e.g. "saw" -> WaveformType::Saw, "true" -> 1.0f, "800" -> 800.0f
+float parseParamValue(ParamValueType type, std::istringstream &iss);
 
 } // namespace synth::param::bindings
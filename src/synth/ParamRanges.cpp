@@ -39,6 +39,14 @@ float clampDrive(float drive) {
 }
 } // namespace filter
 
+// LFO Param Helpers
+namespace lfo {
+float clampRate(float rate) { return std::clamp(rate, RATE_MIN, RATE_MAX); }
+float clampSyncBeats(float syncBeats) {
+  return std::clamp(syncBeats, SYNC_BEATS_MIN, SYNC_BEATS_MAX);
+}
+} // namespace lfo
+
 // Mod Matrix Param Helpers
 namespace mod {
 float clampCutoffMod(float cutoffMod) {
@@ -60,6 +68,9 @@ namespace global {
 float clampMasterGain(float masterGain) {
   return std::clamp(masterGain, MASTER_GAIN_MIN, MASTER_GAIN_MAX);
 }
+float clampTempo(float tempo) {
+  return std::clamp(tempo, TEMPO_MIN, TEMPO_MAX);
+}
 } // namespace global
 
 } // namespace synth::param::ranges
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "synth/Filters.h"
+#include "synth/Noise.h"
 #include "synth/Oscillator.h"
 #include <cstdint>
 
@@ -23,6 +24,12 @@ float clampDetune(float detuneAmount);
 float clampOctave(int8_t octaveOffset);
 } // namespace osc
 
+namespace noise {
+inline constexpr uint8_t NOISE_TYPE_MIN = 0;
+inline constexpr uint8_t NOISE_TYPE_MAX =
+    static_cast<uint8_t>(synth::noise::NoiseType::NOISE_TYPE_COUNT) - 1;
+} // namespace noise
+
 namespace env {
 inline constexpr float TIME_MIN = 0.0f;     // ms
 inline constexpr float TIME_MAX = 10000.0f; // ms
@@ -49,6 +56,16 @@ float clampResonance(float resonance);
 float clampDrive(float drive);
 } // namespace filter
 
+namespace lfo {
+inline constexpr float RATE_MIN = 0.01f; // Hz
+inline constexpr float RATE_MAX = 50.0f; // Hz
+inline constexpr float SYNC_BEATS_MIN = 0.0625f; // 1/64 note
+inline constexpr float SYNC_BEATS_MAX = 16.0f;   // 4 bars of 4/4
+
+float clampRate(float rate);
+float clampSyncBeats(float syncBeats);
+} // namespace lfo
+
 namespace mod {
 // Cutoff modulation depth (octaves, bipolar)
 inline constexpr float CUTOFF_MOD_MIN = -4.0f;
@@ -76,8 +93,11 @@ float clampResonanceMod(float resonanceMod);
 namespace global {
 inline constexpr float MASTER_GAIN_MIN = 0.0f;
 inline constexpr float MASTER_GAIN_MAX = 2.0f; // 2.0 ≈ +6 dB
+inline constexpr float TEMPO_MIN = 20.0f;       // BPM
+inline constexpr float TEMPO_MAX = 300.0f;      // BPM
 
 float clampMasterGain(float masterGain);
+float clampTempo(float tempo);
 } // namespace global
 
 } // namespace synth::param::ranges
@@ -0,0 +1,166 @@
+#include "ParamSmoothing.h"
+
+#include "Types.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace synth::param::smoothing {
+using namespace bindings;
+
+// ==== <Internal Helpers> ====
+namespace {
+// Fraction of a param's range treated as "arrived" by OnePole glides
+constexpr float SETTLE_FRACTION = 1e-4f;
+
+SmoothingMode defaultMode(ParamID id) {
+  switch (id) {
+  case SVF_CUTOFF:
+  case LADDER_CUTOFF:
+    return SmoothingMode::OnePole;
+
+  // Times only feed envelope increments: nothing audible to glide
+  case AMP_ENV_ATTACK:
+  case AMP_ENV_DECAY:
+  case AMP_ENV_RELEASE:
+  case FILTER_ENV_ATTACK:
+  case FILTER_ENV_DECAY:
+  case FILTER_ENV_RELEASE:
+    return SmoothingMode::None;
+
+  // A note division is picked, not swept
+  case LFO1_SYNC_BEATS:
+  case LFO2_SYNC_BEATS:
+  case LFO3_SYNC_BEATS:
+    return SmoothingMode::None;
+
+  default:
+    return SmoothingMode::Linear;
+  }
+}
+
+void removeMoving(ParamSmoother &smoother, uint32_t index) {
+  ParamID id = smoother.movingIds[index];
+  smoother.isMoving[id] = false;
+  smoother.movingIds[index] = smoother.movingIds[--smoother.movingCount];
+}
+} // namespace
+// ==== </Internal Helpers> ====
+
+void initParamSmoother(ParamSmoother &smoother, const ParamBinding *bindings,
+                       float sampleRate, float timeMs) {
+  smoother = ParamSmoother{};
+  smoother.sampleRate = sampleRate;
+
+  for (int i = 0; i < PARAM_COUNT; i++) {
+    auto id = static_cast<ParamID>(i);
+    const ParamBinding &binding = bindings[id];
+
+    smoother.settleDelta[id] = (binding.max - binding.min) * SETTLE_FRACTION;
+
+    SmoothingMode mode = binding.type == FLOAT && timeMs > 0.0f
+                             ? defaultMode(id)
+                             : SmoothingMode::None;
+    setParamSmoothing(smoother, id, mode, timeMs);
+  }
+}
+
+void setParamSmoothing(ParamSmoother &smoother, ParamID id,
+                       SmoothingMode mode, float timeMs) {
+  if (id < 0 || id >= PARAM_COUNT)
+    return;
+
+  if (timeMs <= 0.0f)
+    mode = SmoothingMode::None;
+
+  smoother.mode[id] = mode;
+  smoother.timeMs[id] = timeMs;
+
+  if (mode == SmoothingMode::OnePole) {
+    float timeSamples = timeMs * 0.001f * smoother.sampleRate;
+    smoother.pole[id] = std::exp(-1.0f / timeSamples);
+    smoother.blockPole[id] =
+        std::pow(smoother.pole[id], static_cast<float>(ENGINE_BLOCK_SIZE));
+  }
+}
+
+bool setTarget(ParamSmoother &smoother, ParamID id, float current,
+               float target) {
+  SmoothingMode mode = smoother.mode[id];
+  if (mode == SmoothingMode::None)
+    return false;
+
+  smoother.target[id] = target;
+
+  if (mode == SmoothingMode::Linear) {
+    float timeSamples = smoother.timeMs[id] * 0.001f * smoother.sampleRate;
+    uint32_t samples = static_cast<uint32_t>(std::ceil(timeSamples));
+    if (samples == 0)
+      samples = 1;
+
+    smoother.samplesLeft[id] = samples;
+    smoother.increment[id] = (target - current) / static_cast<float>(samples);
+  }
+
+  if (!smoother.isMoving[id]) {
+    smoother.isMoving[id] = true;
+    smoother.movingIds[smoother.movingCount++] = id;
+  }
+
+  return true;
+}
+
+void cancel(ParamSmoother &smoother, ParamID id) {
+  if (id < 0 || id >= PARAM_COUNT || !smoother.isMoving[id])
+    return;
+
+  for (uint32_t i = 0; i < smoother.movingCount; i++) {
+    if (smoother.movingIds[i] == id) {
+      removeMoving(smoother, i);
+      return;
+    }
+  }
+}
+
+uint32_t advance(ParamSmoother &smoother, const ParamBinding *bindings,
+                 uint32_t numSamples, ParamID *updatedIds) {
+  uint32_t updatedCount = 0;
+
+  uint32_t i = 0;
+  while (i < smoother.movingCount) {
+    ParamID id = smoother.movingIds[i];
+    float *value = bindings[id].floatPtr;
+    float target = smoother.target[id];
+    bool hasArrived = false;
+
+    if (smoother.mode[id] == SmoothingMode::Linear) {
+      if (smoother.samplesLeft[id] <= numSamples) {
+        hasArrived = true;
+      } else {
+        *value += smoother.increment[id] * static_cast<float>(numSamples);
+        smoother.samplesLeft[id] -= numSamples;
+      }
+    } else {
+      // Short (event-split) blocks need their own decay
+      float decay = numSamples == ENGINE_BLOCK_SIZE
+                        ? smoother.blockPole[id]
+                        : std::pow(smoother.pole[id],
+                                   static_cast<float>(numSamples));
+      *value = target + (*value - target) * decay;
+      hasArrived = std::fabs(target - *value) <= smoother.settleDelta[id];
+    }
+
+    updatedIds[updatedCount++] = id;
+
+    if (hasArrived) {
+      *value = target;
+      removeMoving(smoother, i); // swaps the last one in: don't advance i
+    } else {
+      i++;
+    }
+  }
+
+  return updatedCount;
+}
+
+} // namespace synth::param::smoothing
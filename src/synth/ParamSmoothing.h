@@ -0,0 +1,70 @@
+#pragma once
+
+#include "ParamBindings.h"
+
+#include <cstdint>
+
+/* ==== Param Smoothing ====
+ * FLOAT params glide to a new value instead of jumping to it (zipper noise,
+ * and one burst of derived-value updates per event, e.g. filter
+ * coefficients). The bound value moves once per engine block, so
+ * onParamUpdate runs at most once per block per moving param.
+ *
+ * Only params that are moving are visited: the rest cost nothing per block.
+ */
+namespace synth::param::smoothing {
+using ParamBinding = bindings::ParamBinding;
+using ParamID = bindings::ParamID;
+
+inline constexpr float DEFAULT_SMOOTHING_MS = 20.0f;
+
+enum class SmoothingMode : uint8_t {
+  None,    // jump (e.g. envelope times: nothing to glide)
+  Linear,  // constant rate, reaches the target in exactly timeMs
+  OnePole, // exponential approach (timeMs is the time constant)
+};
+
+struct ParamSmoother {
+  float sampleRate = 0.0f;
+
+  // ==== Per-param config ====
+  SmoothingMode mode[ParamID::PARAM_COUNT]{};
+  float timeMs[ParamID::PARAM_COUNT]{};
+  float pole[ParamID::PARAM_COUNT]{};      // OnePole: per-sample decay
+  float blockPole[ParamID::PARAM_COUNT]{}; // pole ^ ENGINE_BLOCK_SIZE
+  float settleDelta[ParamID::PARAM_COUNT]{}; // snap once this close
+
+  // ==== Per-param state ====
+  float target[ParamID::PARAM_COUNT]{};
+  float increment[ParamID::PARAM_COUNT]{}; // Linear: per sample
+  uint32_t samplesLeft[ParamID::PARAM_COUNT]{};
+  bool isMoving[ParamID::PARAM_COUNT]{};
+
+  // Dense list of moving params
+  ParamID movingIds[ParamID::PARAM_COUNT]{};
+  uint32_t movingCount = 0;
+};
+
+// Default modes: levels/amounts linear, cutoffs one-pole, envelope times
+// and non-float params jump. _timeMs_ of 0 disables smoothing
+void initParamSmoother(ParamSmoother &smoother, const ParamBinding *bindings,
+                       float sampleRate, float timeMs);
+
+void setParamSmoothing(ParamSmoother &smoother, ParamID id,
+                       SmoothingMode mode, float timeMs);
+
+// Start gliding _id_ from _current_ to _target_.
+// Returns false if _id_ isn't smoothed (the caller writes it directly)
+bool setTarget(ParamSmoother &smoother, ParamID id, float current,
+               float target);
+
+// Stop any glide on _id_ (e.g. it was written directly)
+void cancel(ParamSmoother &smoother, ParamID id);
+
+// Move every gliding param by _numSamples_, writing the bound floats.
+// Fills _updatedIds_ (PARAM_COUNT capacity) with the params that changed
+// and returns how many
+uint32_t advance(ParamSmoother &smoother, const ParamBinding *bindings,
+                 uint32_t numSamples, ParamID *updatedIds);
+
+} // namespace synth::param::smoothing
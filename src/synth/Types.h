@@ -18,4 +18,7 @@ using MidiNote = uint8_t;
 // 1.0f / std::sqrtf(MAX_VOICES);
 inline constexpr float VOICE_GAIN = 1.0f / 8.0f;
 
+// Signals and filter states below this count as silence (-120 dB)
+inline constexpr float SILENCE_EPSILON = 1e-6f;
+
 } // namespace synth
@@ -0,0 +1,592 @@
+#include "VoiceLanes.h"
+#include "Envelope.h"
+#include "Filters.h"
+#include "Oscillator.h"
+#include "Types.h"
+
+#include "synth/ModMatrix.h"
+#include "synth/ParamRanges.h"
+
+#include "dsp/Denormals.h"
+#include "dsp/Filters.h"
+#include "dsp/FastMath.h"
+#include "dsp/Math.h"
+#include "dsp/Noise.h"
+#include "dsp/Wavetable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VOICE_LANES_X86 1
+#else
+#define VOICE_LANES_X86 0
+#endif
+
+// Helpers MUST be inlined into the dispatched kernels, otherwise they're
+// compiled for the baseline instruction set and the lane loops won't vectorize
+#define LANE_INLINE inline __attribute__((always_inline))
+
+namespace synth::voices::lanes {
+using ModDest = mod_matrix::ModDest;
+using SVFMode = filters::SVFMode;
+using dsp::denormals::flushDenormal;
+
+namespace {
+constexpr uint32_t NUM_OSCS = 4;
+
+constexpr ModDest OSC_PITCH_DESTS[NUM_OSCS] = {
+    ModDest::Osc1Pitch, ModDest::Osc2Pitch, ModDest::Osc3Pitch,
+    ModDest::SubOscPitch};
+
+constexpr ModDest OSC_MIX_DESTS[NUM_OSCS] = {
+    ModDest::Osc1Mix, ModDest::Osc2Mix, ModDest::Osc3Mix, ModDest::SubOscMix};
+
+constexpr uint32_t OSC_STAGES[NUM_OSCS] = {STAGE_OSC1, STAGE_OSC2, STAGE_OSC3,
+                                           STAGE_SUB_OSC};
+
+// ==== <Lane Math> ====
+// Branch-free versions of the dsp:: kernels so each loop across lanes
+// compiles to straight-line SIMD (selects instead of branches)
+
+// Same as dsp::math::fastExp2
+LANE_INLINE float laneExp2(float x) {
+  int32_t xi = static_cast<int32_t>(x);
+  float xf = x - static_cast<float>(xi);
+
+  float p =
+      1.0f + xf * (0.6931472f +
+                   xf * (0.2402265f + xf * (0.0555041f + xf * 0.0096181f)));
+
+  int32_t bits;
+  std::memcpy(&bits, &p, 4);
+  bits += xi * (1 << 23);
+  std::memcpy(&p, &bits, 4);
+  return p;
+}
+
+// Interpolated wavetable read from the row starting at _row_
+LANE_INLINE float laneWavetable(const float *row, float phase) {
+  float position = phase * static_cast<float>(dsp::wavetable::TABLE_SIZE);
+  int32_t index = static_cast<int32_t>(position);
+  float frac = position - static_cast<float>(index);
+
+  return row[index] + frac * (row[index + 1] - row[index]);
+}
+// ==== </Lane Math> ====
+
+// Lane-contiguous copy of everything a group of voices touches in a block
+template <uint32_t W> struct LaneGroup {
+  uint32_t voices[W];
+  uint32_t count;
+
+  // Stages on this block (lane kernels test them once per sample, they
+  // aren't instantiated per combination like the scalar paths)
+  uint32_t oscs[NUM_OSCS]; // indices of the oscillators that are on
+  uint32_t numOscs;
+  bool hasNoise, hasSVF, hasLadder;
+
+  // Oscillators
+  float phases[NUM_OSCS][W];
+  float baseIncs[NUM_OSCS][W];
+  float pitchPrev[NUM_OSCS][W]; // semitones at block start
+  float pitchStep[NUM_OSCS][W]; // semitones per sample
+  float mixLevels[NUM_OSCS][W];
+  int32_t tableRows[NUM_OSCS][W]; // mip level offset (per block)
+
+  // Noise (stream key + position, pink filter state)
+  uint32_t noiseKeys[W], noiseCounters[W];
+  float noisePink0[W], noisePink1[W], noisePink2[W];
+
+  // SVF (coefficients are per block, mod values don't change within one)
+  float svfA1[W], svfA2[W], svfA3[W], svfK[W];
+  float svfGStart[W], svfKStart[W]; // interpolation (start + step * n)
+  float svfGStep[W], svfKStep[W];
+  float svfIc1[W], svfIc2[W];
+
+  // Ladder (steps are 0 unless interpolating)
+  float ladderF[W], ladderRes[W];
+  float ladderFStep[W], ladderResStep[W];
+  float ladderS0[W], ladderS1[W], ladderS2[W], ladderS3[W];
+
+  // Output
+  float gains[W]; // velocity * VOICE_GAIN (0 for padding lanes)
+  float ampEnv[ENGINE_BLOCK_SIZE][W];
+};
+
+// Pool voice in lane _l_: with a compacted pool the group is the slot run
+// voices[0] .. voices[0] + count - 1, so each field below is a contiguous
+// load/store instead of a gather/scatter
+template <bool CONTIGUOUS>
+LANE_INLINE uint32_t laneVoice(const uint32_t *voices, uint32_t l) {
+  return CONTIGUOUS ? voices[0] + l : voices[l];
+}
+
+// Padding lanes run on harmless values and are never scattered back
+template <uint32_t W>
+LANE_INLINE void padGroup(LaneGroup<W> &group, uint32_t count,
+                          uint32_t numSamples) {
+  for (uint32_t l = count; l < W; l++) {
+    group.voices[l] = MAX_VOICES;
+    for (uint32_t o = 0; o < NUM_OSCS; o++) {
+      group.phases[o][l] = 0.0f;
+      group.baseIncs[o][l] = 0.01f;
+      group.pitchPrev[o][l] = 0.0f;
+      group.pitchStep[o][l] = 0.0f;
+      group.tableRows[o][l] = 0;
+      group.mixLevels[o][l] = 0.0f;
+    }
+    group.noiseKeys[l] = group.noiseCounters[l] = 0;
+    group.noisePink0[l] = group.noisePink1[l] = group.noisePink2[l] = 0.0f;
+    group.svfA1[l] = group.svfA2[l] = group.svfA3[l] = group.svfK[l] = 0.0f;
+    group.svfGStart[l] = group.svfKStart[l] = 0.0f;
+    group.svfGStep[l] = group.svfKStep[l] = 0.0f;
+    group.svfIc1[l] = group.svfIc2[l] = 0.0f;
+    group.ladderF[l] = group.ladderRes[l] = 0.0f;
+    group.ladderFStep[l] = group.ladderResStep[l] = 0.0f;
+    group.ladderS0[l] = group.ladderS1[l] = 0.0f;
+    group.ladderS2[l] = group.ladderS3[l] = 0.0f;
+    group.gains[l] = 0.0f;
+    for (uint32_t s = 0; s < numSamples; s++)
+      group.ampEnv[s][l] = 0.0f;
+  }
+}
+
+// ==== Gather: pool (SoA by voice index) -> lanes ====
+// One field at a time across the lanes
+template <uint32_t W, bool CONTIGUOUS>
+LANE_INLINE void gatherGroup(VoicePool &pool, LaneGroup<W> &group,
+                             const uint32_t *voices, uint32_t count,
+                             uint32_t numSamples) {
+  const Oscillator *oscs[NUM_OSCS] = {&pool.osc1, &pool.osc2, &pool.osc3,
+                                      &pool.subOsc};
+  const mod_matrix::ModMatrix &matrix = pool.modMatrix;
+  const float invNumSamples = 1.0f / static_cast<float>(numSamples);
+  const float lastSample = static_cast<float>(numSamples - 1);
+
+  group.count = count;
+  for (uint32_t l = 0; l < count; l++)
+    group.voices[l] = laneVoice<CONTIGUOUS>(voices, l);
+  padGroup(group, count, numSamples);
+
+  for (uint32_t k = 0; k < group.numOscs; k++) {
+    uint32_t o = group.oscs[k];
+    const Oscillator &osc = *oscs[o];
+    const float *pitchPrev = matrix.prevDestValues[OSC_PITCH_DESTS[o]];
+    const float *pitchStep = matrix.destStepValues[OSC_PITCH_DESTS[o]];
+    const float *mixMod = matrix.destValues[OSC_MIX_DESTS[o]];
+
+    for (uint32_t l = 0; l < count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      group.phases[o][l] = osc.phases[v];
+      group.baseIncs[o][l] = osc.phaseIncrements[v];
+      group.pitchPrev[o][l] = pitchPrev[v];
+      group.pitchStep[o][l] = pitchStep[v];
+      group.mixLevels[o][l] =
+          param::ranges::osc::clampMixLevel(osc.mixLevel + mixMod[v]);
+    }
+
+    // Mip level for the highest pitch this block (same rule as
+    // dsp::wavetable::processWavetableBlock)
+    for (uint32_t l = 0; l < count; l++) {
+      float pitchStart = group.pitchPrev[o][l];
+      float pitchEnd = pitchStart + group.pitchStep[o][l] * lastSample;
+      float maxIncrement =
+          group.baseIncs[o][l] *
+          dsp::math::semitonesToFreqRatio(std::max(pitchStart, pitchEnd));
+      group.tableRows[o][l] = static_cast<int32_t>(
+          dsp::wavetable::mipLevel(maxIncrement) * dsp::wavetable::ROW_SIZE);
+    }
+  }
+
+  if (group.hasNoise) {
+    for (uint32_t l = 0; l < count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      group.noiseKeys[l] = pool.noise.keys[v];
+      group.noiseCounters[l] = pool.noise.counters[v];
+      group.noisePink0[l] = pool.noise.pinkB0[v];
+      group.noisePink1[l] = pool.noise.pinkB1[v];
+      group.noisePink2[l] = pool.noise.pinkB2[v];
+    }
+  }
+
+  // SVF (per-block coefficients from preProcessBlock)
+  if (group.hasSVF) {
+    for (uint32_t l = 0; l < count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      const dsp::filters::SVFCoeffs &coeffs = pool.svf.voiceCoeffs[v];
+      const dsp::filters::SVFCoeffs &prev = pool.svf.prevVoiceCoeffs[v];
+
+      group.svfA1[l] = coeffs.a1;
+      group.svfA2[l] = coeffs.a2;
+      group.svfA3[l] = coeffs.a3;
+      group.svfK[l] = coeffs.k;
+
+      // Same ramp as dsp::filters::processSVFBlock (from, to]
+      group.svfGStart[l] = prev.g;
+      group.svfKStart[l] = prev.k;
+      group.svfGStep[l] = (coeffs.g - prev.g) * invNumSamples;
+      group.svfKStep[l] = (coeffs.k - prev.k) * invNumSamples;
+
+      group.svfIc1[l] = pool.svf.voiceStates[v].ic1;
+      group.svfIc2[l] = pool.svf.voiceStates[v].ic2;
+    }
+  }
+
+  // Ladder (per-block coefficient from preProcessBlock)
+  if (group.hasLadder) {
+    const bool interpolate = pool.ladder.interpolateCoeffs;
+
+    for (uint32_t l = 0; l < count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      float toF = pool.ladder.voiceCoeffs[v];
+      float toRes = pool.ladder.voiceResonances[v];
+      float fromF = interpolate ? pool.ladder.prevVoiceCoeffs[v] : toF;
+      float fromRes = interpolate ? pool.ladder.prevVoiceResonances[v] : toRes;
+
+      group.ladderF[l] = fromF;
+      group.ladderRes[l] = fromRes;
+      group.ladderFStep[l] = (toF - fromF) * invNumSamples;
+      group.ladderResStep[l] = (toRes - fromRes) * invNumSamples;
+
+      const dsp::filters::LadderState &st = pool.ladder.voiceStates[v];
+      group.ladderS0[l] = st.s[0];
+      group.ladderS1[l] = st.s[1];
+      group.ladderS2[l] = st.s[2];
+      group.ladderS3[l] = st.s[3];
+    }
+  }
+
+  for (uint32_t l = 0; l < count; l++) {
+    uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+    group.gains[l] = pool.velocities[v] * VOICE_GAIN;
+
+    // Amp envelope is independent of the audio path, so run it up front
+    float ampEnv[ENGINE_BLOCK_SIZE];
+    envelope::processEnvelopeBlock(pool.ampEnv, v, ampEnv, numSamples);
+
+    for (uint32_t s = 0; s < numSamples; s++)
+      group.ampEnv[s][l] = ampEnv[s];
+  }
+}
+
+// ==== Scatter: lanes -> pool ====
+template <uint32_t W, bool CONTIGUOUS>
+LANE_INLINE void scatterGroup(VoicePool &pool, const LaneGroup<W> &group) {
+  Oscillator *oscs[NUM_OSCS] = {&pool.osc1, &pool.osc2, &pool.osc3,
+                                &pool.subOsc};
+  const uint32_t *voices = group.voices;
+
+  for (uint32_t k = 0; k < group.numOscs; k++) {
+    uint32_t o = group.oscs[k];
+    for (uint32_t l = 0; l < group.count; l++)
+      oscs[o]->phases[laneVoice<CONTIGUOUS>(voices, l)] = group.phases[o][l];
+  }
+
+  if (group.hasNoise) {
+    for (uint32_t l = 0; l < group.count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      pool.noise.counters[v] = group.noiseCounters[l];
+      pool.noise.pinkB0[v] = group.noisePink0[l];
+      pool.noise.pinkB1[v] = group.noisePink1[l];
+      pool.noise.pinkB2[v] = group.noisePink2[l];
+    }
+  }
+
+  if (group.hasSVF) {
+    for (uint32_t l = 0; l < group.count; l++) {
+      uint32_t v = laneVoice<CONTIGUOUS>(voices, l);
+      // Denormal guard, like the scalar filter blocks
+      pool.svf.voiceStates[v].ic1 = flushDenormal(group.svfIc1[l]);
+      pool.svf.voiceStates[v].ic2 = flushDenormal(group.svfIc2[l]);
+    }
+  }
+
+  if (group.hasLadder) {
+    for (uint32_t l = 0; l < group.count; l++) {
+      dsp::filters::LadderState &st =
+          pool.ladder.voiceStates[laneVoice<CONTIGUOUS>(voices, l)];
+      st.s[0] = flushDenormal(group.ladderS0[l]);
+      st.s[1] = flushDenormal(group.ladderS1[l]);
+      st.s[2] = flushDenormal(group.ladderS2[l]);
+      st.s[3] = flushDenormal(group.ladderS3[l]);
+    }
+  }
+}
+
+// ==== Kernel: every stage is a loop across lanes ====
+template <uint32_t W>
+LANE_INLINE void renderGroup(const VoicePool &pool, LaneGroup<W> &group,
+                             float *output, uint32_t numSamples) {
+  const Oscillator *oscs[NUM_OSCS] = {&pool.osc1, &pool.osc2, &pool.osc3,
+                                      &pool.subOsc};
+
+  const bool noiseEnabled = group.hasNoise;
+  const bool noisePink = pool.noise.type == noise::NoiseType::Pink;
+  const float noiseLevel = pool.noise.mixLevel;
+
+  const bool svfEnabled = group.hasSVF;
+  const bool svfInterpolate = pool.svf.interpolateCoeffs;
+  const SVFMode svfMode = pool.svf.mode;
+  const bool ladderEnabled = group.hasLadder;
+  const bool ladderNonlinear = pool.ladder.drive > 1.001f;
+  const float ladderDrive = pool.ladder.drive;
+
+  for (uint32_t s = 0; s < numSamples; s++) {
+    const float sampleIndex = static_cast<float>(s);
+    float voiceOut[W] = {};
+
+    // ==== Oscillators (interpolated pitch mod) ====
+    for (uint32_t k = 0; k < group.numOscs; k++) {
+      const uint32_t o = group.oscs[k];
+      const float *samples = oscillator::getWavetable(*oscs[o]).samples[0];
+      float *phases = group.phases[o];
+
+      for (uint32_t l = 0; l < W; l++) {
+        float pitchMod =
+            group.pitchPrev[o][l] + group.pitchStep[o][l] * sampleIndex;
+        float inc = group.baseIncs[o][l] * laneExp2(pitchMod / 12.0f);
+
+        voiceOut[l] +=
+            laneWavetable(samples + group.tableRows[o][l], phases[l]) *
+            group.mixLevels[o][l];
+
+        float phase = phases[l] + inc;
+        phases[l] = phase >= 1.0f ? phase - 1.0f : phase;
+      }
+    }
+
+    // ==== Noise (counter-based: no state carried between samples) ====
+    if (noiseEnabled) {
+      float noiseOut[W];
+      for (uint32_t l = 0; l < W; l++)
+        noiseOut[l] =
+            dsp::noise::white(group.noiseKeys[l], group.noiseCounters[l] + s);
+
+      if (noisePink) {
+        for (uint32_t l = 0; l < W; l++)
+          noiseOut[l] =
+              dsp::noise::pink(group.noisePink0[l], group.noisePink1[l],
+                               group.noisePink2[l], noiseOut[l]);
+      }
+
+      for (uint32_t l = 0; l < W; l++)
+        voiceOut[l] += noiseOut[l] * noiseLevel;
+    }
+
+    for (uint32_t l = 0; l < W; l++)
+      voiceOut[l] *= pool.oscMixGain;
+
+    // ==== SVF (Cytomic/TPT) ====
+    if (svfEnabled) {
+      if (svfInterpolate) {
+        const float ramp = sampleIndex + 1.0f;
+        for (uint32_t l = 0; l < W; l++) {
+          float g = group.svfGStart[l] + group.svfGStep[l] * ramp;
+          float k = group.svfKStart[l] + group.svfKStep[l] * ramp;
+          float a1 = 1.0f / (1.0f + g * (g + k));
+
+          group.svfA1[l] = a1;
+          group.svfA2[l] = g * a1;
+          group.svfA3[l] = g * group.svfA2[l];
+          group.svfK[l] = k;
+        }
+      }
+
+      for (uint32_t l = 0; l < W; l++) {
+        float in = voiceOut[l];
+        float ic1 = group.svfIc1[l];
+        float ic2 = group.svfIc2[l];
+
+        float v3 = in - ic2;
+        float v1 = group.svfA1[l] * ic1 + group.svfA2[l] * v3;
+        float v2 = ic2 + group.svfA2[l] * ic1 + group.svfA3[l] * v3;
+
+        group.svfIc1[l] = 2.0f * v1 - ic1;
+        group.svfIc2[l] = 2.0f * v2 - ic2;
+
+        float lp = v2;
+        float bp = v1;
+        float hp = in - group.svfK[l] * v1 - v2;
+
+        voiceOut[l] = svfMode == SVFMode::HP      ? hp
+                      : svfMode == SVFMode::BP    ? bp
+                      : svfMode == SVFMode::Notch ? lp + hp
+                                                  : lp;
+      }
+    }
+
+    // ==== Ladder ====
+    if (ladderEnabled) {
+      const float ramp = sampleIndex + 1.0f;
+      for (uint32_t l = 0; l < W; l++) {
+        float f = group.ladderF[l] + group.ladderFStep[l] * ramp;
+        float res = group.ladderRes[l] + group.ladderResStep[l] * ramp;
+        float x = ladderNonlinear
+                      ? dsp::math::fastTanh(
+                            ladderDrive * voiceOut[l] -
+                            res * dsp::math::fastTanh(group.ladderS3[l]))
+                      : voiceOut[l] - res * group.ladderS3[l];
+
+        group.ladderS0[l] += f * (x - group.ladderS0[l]);
+        group.ladderS1[l] += f * (group.ladderS0[l] - group.ladderS1[l]);
+        group.ladderS2[l] += f * (group.ladderS1[l] - group.ladderS2[l]);
+        group.ladderS3[l] += f * (group.ladderS2[l] - group.ladderS3[l]);
+
+        voiceOut[l] = group.ladderS3[l];
+      }
+    }
+
+    // ==== Amp + sum lanes ====
+    float sample = 0.0f;
+    for (uint32_t l = 0; l < W; l++)
+      sample += voiceOut[l] * group.ampEnv[s][l] * group.gains[l];
+
+    output[s] += sample;
+  }
+
+  if (noiseEnabled) {
+    for (uint32_t l = 0; l < W; l++)
+      group.noiseCounters[l] += numSamples;
+  }
+}
+
+template <uint32_t W>
+LANE_INLINE void renderAllGroups(VoicePool &pool, float *output,
+                                 uint32_t numSamples, uint32_t stages) {
+  LaneGroup<W> group;
+
+  group.numOscs = 0;
+  for (uint32_t o = 0; o < NUM_OSCS; o++) {
+    if (stages & OSC_STAGES[o])
+      group.oscs[group.numOscs++] = o;
+  }
+  group.hasNoise = (stages & STAGE_NOISE) != 0;
+  group.hasSVF = (stages & STAGE_SVF) != 0;
+  group.hasLadder = (stages & STAGE_LADDER) != 0;
+
+  for (uint32_t first = 0; first < pool.activeCount; first += W) {
+    uint32_t count = std::min(W, pool.activeCount - first);
+    const uint32_t *voices = pool.activeIndices + first;
+
+    if (pool.compactVoices)
+      gatherGroup<W, true>(pool, group, voices, count, numSamples);
+    else
+      gatherGroup<W, false>(pool, group, voices, count, numSamples);
+
+    renderGroup(pool, group, output, numSamples);
+
+    if (pool.compactVoices)
+      scatterGroup<W, true>(pool, group);
+    else
+      scatterGroup<W, false>(pool, group);
+  }
+}
+
+// ==== <Dispatch Targets> ====
+void renderAllGroups4(VoicePool &pool, float *output, uint32_t numSamples,
+                      uint32_t stages) {
+  renderAllGroups<4>(pool, output, numSamples, stages);
+}
+
+#if VOICE_LANES_X86
+__attribute__((target("avx2,fma"))) void
+renderAllGroups8(VoicePool &pool, float *output, uint32_t numSamples,
+                 uint32_t stages) {
+  renderAllGroups<8>(pool, output, numSamples, stages);
+}
+
+__attribute__((target("avx512f,avx512dq"))) void
+renderAllGroups16(VoicePool &pool, float *output, uint32_t numSamples,
+                  uint32_t stages) {
+  renderAllGroups<16>(pool, output, numSamples, stages);
+}
+#else
+// No wider registers to dispatch to: 8/16 are unrolled 4-lane groups
+void renderAllGroups8(VoicePool &pool, float *output, uint32_t numSamples,
+                      uint32_t stages) {
+  renderAllGroups<8>(pool, output, numSamples, stages);
+}
+
+void renderAllGroups16(VoicePool &pool, float *output, uint32_t numSamples,
+                       uint32_t stages) {
+  renderAllGroups<16>(pool, output, numSamples, stages);
+}
+#endif
+// ==== </Dispatch Targets> ====
+
+// Same rule as the scalar path (isVoiceFinished)
+void retireFinishedVoices(VoicePool &pool) {
+  uint32_t finished[MAX_VOICES];
+  uint32_t numFinished = 0;
+
+  for (uint32_t i = 0; i < pool.activeCount; i++) {
+    uint32_t v = pool.activeIndices[i];
+    if (isVoiceFinished(pool, v))
+      finished[numFinished++] = v;
+  }
+
+  // Highest slot first: a compacted removal moves the last voice down
+  for (uint32_t i = numFinished; i > 0; i--)
+    retireVoice(pool, finished[i - 1]);
+}
+
+} // namespace
+
+uint32_t detectLaneWidth() {
+#if VOICE_LANES_X86
+  static const uint32_t laneWidth = [] {
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+      return 16u;
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return 8u;
+
+    return 4u;
+  }();
+
+  return laneWidth;
+#else
+  return 4;
+#endif
+}
+
+uint32_t validateLaneWidth(uint32_t laneWidth) {
+  // Auto: 16-wide measured slower than 8 (register pressure), so it's opt-in
+  if (laneWidth != 4 && laneWidth != 8 && laneWidth != 16)
+    return std::min(detectLaneWidth(), 8u);
+
+#if VOICE_LANES_X86
+  // Can't run AVX2/AVX-512 kernels on a CPU without them
+  if (laneWidth > detectLaneWidth())
+    return detectLaneWidth();
+#endif
+
+  return laneWidth;
+}
+
+void renderVoiceLanes(VoicePool &pool, float *output, size_t numSamples,
+                      uint32_t stages) {
+  uint32_t n = static_cast<uint32_t>(
+      std::min(numSamples, static_cast<size_t>(ENGINE_BLOCK_SIZE)));
+
+  switch (pool.laneWidth) {
+  case 16:
+    renderAllGroups16(pool, output, n, stages);
+    break;
+  case 8:
+    renderAllGroups8(pool, output, n, stages);
+    break;
+  default:
+    renderAllGroups4(pool, output, n, stages);
+    break;
+  }
+
+  retireFinishedVoices(pool);
+}
+
+} // namespace synth::voices::lanes
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "VoicePool.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ==== Voice Lanes (SIMD across voices) ====
+ * Active voices are processed in groups of 4/8/16, one voice per SIMD lane.
+ * Per-voice state is gathered from the SoA pool arrays once per block into
+ * lane-contiguous arrays, every stage runs as a branch-free loop across the
+ * lanes, and state is scattered back at the end of the block. With
+ * compactVoices each group is a run of slots, so those are plain loads.
+ *
+ * Kernel width is picked at runtime:
+ *   x86: 16 (AVX-512), 8 (AVX2), 4 (SSE2 baseline)
+ *   arm: 4 (NEON baseline)
+ */
+namespace synth::voices::lanes {
+inline constexpr uint32_t MAX_LANE_WIDTH = 16;
+
+// Widest lane width supported by this CPU (checked once)
+uint32_t detectLaneWidth();
+
+// Returns _laneWidth_ if supported, otherwise the widest supported width
+// (capped at 8 unless 16 is asked for explicitly)
+uint32_t validateLaneWidth(uint32_t laneWidth);
+
+/* Render all active voices and ADD the summed (pre master gain) mix into
+ * _output_. Voices whose amp envelope finished are retired afterwards.
+ * Only the _stages_ that are set run (see RenderStage).
+ * numSamples must be <= ENGINE_BLOCK_SIZE (mod matrix values are per block)
+ */
+void renderVoiceLanes(VoicePool &pool, float *output, size_t numSamples,
+                      uint32_t stages);
+
+} // namespace synth::voices::lanes
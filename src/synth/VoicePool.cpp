@@ -2,15 +2,25 @@
 #include "Envelope.h"
 #include "Oscillator.h"
 #include "Types.h"
+#include "VoiceLanes.h"
+#include "WorkerPool.h"
 
 #include "synth/Filters.h"
 #include "synth/ModMatrix.h"
 
 #include "dsp/Effects.h"
 #include "dsp/Math.h"
+#include "dsp/SignalHealth.h"
+#include "dsp/Wavetable.h"
 
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
 namespace synth::voices {
 using ModSrc = mod_matrix::ModSrc;
@@ -18,6 +28,72 @@ using ModDest = mod_matrix::ModDest;
 using ModDest2D = mod_matrix::ModDest2D;
 using ModRoute = mod_matrix::ModRoute;
 
+// ==== <Compaction Helpers> ====
+namespace {
+
+uint64_t voiceBit(uint32_t voiceIndex) { return uint64_t{1} << voiceIndex; }
+
+// Copy every per-voice entry of slot _from_ into slot _to_, masks too
+void moveVoice(VoicePool &pool, uint32_t from, uint32_t to) {
+  pool.midiNotes[to] = pool.midiNotes[from];
+  pool.velocities[to] = pool.velocities[from];
+  pool.noteOnTimes[to] = pool.noteOnTimes[from];
+  pool.isActive[to] = pool.isActive[from];
+
+  oscillator::moveVoice(pool.osc1, from, to);
+  oscillator::moveVoice(pool.osc2, from, to);
+  oscillator::moveVoice(pool.osc3, from, to);
+  oscillator::moveVoice(pool.subOsc, from, to);
+  noise::moveVoice(pool.noise, from, to);
+
+  envelope::moveVoice(pool.ampEnv, from, to);
+  envelope::moveVoice(pool.filterEnv, from, to);
+  envelope::moveVoice(pool.modEnv, from, to);
+
+  for (LFO &lfo : pool.lfos)
+    lfo::moveVoice(lfo, from, to);
+
+  filters::moveSVFVoice(pool.svf, from, to);
+  filters::moveLadderVoice(pool.ladder, from, to);
+  mod_matrix::moveVoice(pool.modMatrix, from, to);
+
+  uint64_t &heldMask = pool.heldNoteMasks[pool.midiNotes[to]];
+  if (heldMask & voiceBit(from))
+    heldMask = (heldMask & ~voiceBit(from)) | voiceBit(to);
+
+  if (pool.releasedMask & voiceBit(from))
+    pool.releasedMask = (pool.releasedMask & ~voiceBit(from)) | voiceBit(to);
+}
+
+// Move voices down into the free slots below activeCount
+void packActiveVoices(VoicePool &pool) {
+  uint32_t last = MAX_VOICES;
+
+  for (uint32_t slot = 0; slot < pool.activeCount; slot++) {
+    if (pool.isActive[slot])
+      continue;
+
+    do {
+      last--;
+    } while (!pool.isActive[last]);
+
+    moveVoice(pool, last, slot);
+    pool.isActive[last] = 0;
+  }
+
+  for (uint32_t i = 0; i < pool.activeCount; i++) {
+    pool.activeIndices[i] = i;
+    pool.activePositions[i] = i;
+  }
+
+  pool.freeMask = pool.activeCount == MAX_VOICES
+                      ? 0
+                      : ~uint64_t{0} << pool.activeCount;
+}
+
+} // namespace
+// ==== </Compaction Helpers> ====
+
 // =========================
 // VoicePool Configuration
 // =========================
@@ -26,6 +102,25 @@ void updateVoicePoolConfig(VoicePool &pool, const VoicePoolConfig &config) {
   pool.invSampleRate = 1.0f / config.sampleRate;
 
   pool.masterGain = config.masterGain;
+  pool.tempoBpm = config.tempoBpm;
+  pool.noise.seed = config.noiseSeed;
+
+  // Built once (first engine), oscillators only read them afterwards
+  dsp::wavetable::initBuiltinTables();
+
+  pool.renderMode = config.renderMode;
+  pool.laneWidth = lanes::validateLaneWidth(config.laneWidth);
+
+  pool.silenceThreshold =
+      std::pow(10.0f, config.silenceThresholdDb / 20.0f); // -inf: 0
+
+  pool.compactVoices = config.compactVoices;
+  if (pool.compactVoices)
+    packActiveVoices(pool);
+
+  workers::destroyWorkerPool(pool.workerPool);
+  pool.workerPool =
+      workers::createWorkerPool(config.numWorkers, config.workerPolicy);
 
   oscillator::updateConfig(pool.osc1, config.osc1);
   oscillator::updateConfig(pool.osc2, config.osc2);
@@ -34,6 +129,8 @@ void updateVoicePoolConfig(VoicePool &pool, const VoicePoolConfig &config) {
 
   filters::updateSVFCoefficients(pool.svf, pool.invSampleRate);
   filters::updateLadderCoefficient(pool.ladder, pool.invSampleRate);
+  pool.svf.interpolateCoeffs = config.interpolateFilterCoeffs;
+  pool.ladder.interpolateCoeffs = config.interpolateFilterCoeffs;
 
   mod_matrix::addRoute(pool.modMatrix, ModSrc::FilterEnv, ModDest::SVFCutoff,
                        0.0f);
@@ -41,81 +138,161 @@ void updateVoicePoolConfig(VoicePool &pool, const VoicePoolConfig &config) {
                        0.0f);
 }
 
+void disposeVoicePool(VoicePool &pool) {
+  workers::destroyWorkerPool(pool.workerPool);
+  pool.workerPool = nullptr;
+}
+
 // =========================
 //  Voice Allocation
 // =========================
-// Find free or oldest voice index for voice Initialization
-uint32_t allocateVoiceIndex(VoicePool &pool) {
-  uint32_t oldestIndex = MAX_VOICES; // out of range
-  uint32_t oldestNoteOnTime = UINT32_MAX;
+
+// ==== <Allocation Helpers> ====
+namespace {
+
+uint32_t lowestVoice(uint64_t mask) {
+  return static_cast<uint32_t>(__builtin_ctzll(mask));
+}
+
+// Steal order among _candidates_ (non-empty): quietest (amp level *
+// velocity), oldest on ties. Gains are >= 0 so their float bits order like
+// the values; a NaN gain sorts last
+uint32_t findQuietestVoice(const VoicePool &pool, uint64_t candidates) {
+  auto stealKey = [&](uint32_t i) {
+    float gain = pool.ampEnv.levels[i] * pool.velocities[i];
+    uint32_t gainBits;
+    std::memcpy(&gainBits, &gain, sizeof(gainBits));
+    return (uint64_t{gainBits} << 32) | pool.noteOnTimes[i];
+  };
+
+  uint32_t quietestIndex = lowestVoice(candidates);
+  uint64_t quietestKey = stealKey(quietestIndex);
+
+  for (candidates &= candidates - 1; candidates;
+       candidates &= candidates - 1) {
+    uint32_t i = lowestVoice(candidates);
+    uint64_t key = stealKey(i);
+    quietestIndex = key < quietestKey ? i : quietestIndex;
+    quietestKey = std::min(quietestKey, key);
+  }
+
+  return quietestIndex;
+}
+
+// Steal order: released voices (already fading out) before held ones,
+// quietest first, oldest on ties. Only called with the pool full. A few
+// released voices are a walk over their bits; otherwise every voice is a
+// candidate and the passes are straight loops over the pool (min
+// reductions, no per-voice branches)
+uint32_t findStealVoice(const VoicePool &pool) {
+  constexpr int FEW_RELEASED = 8;
+  constexpr float HELD_PENALTY = 2.0f; // above any level * velocity
+
+  if (pool.releasedMask &&
+      __builtin_popcountll(pool.releasedMask) <= FEW_RELEASED)
+    return findQuietestVoice(pool, pool.releasedMask);
+
+  float scores[MAX_VOICES];
+  float quietestScore = FLT_MAX;
 
   for (uint32_t i = 0; i < MAX_VOICES; i++) {
-    if (!pool.isActive[i]) {
-      return i; // return available voice index
-    } else {
-      if (pool.noteOnTimes[i] < oldestNoteOnTime) {
-        oldestNoteOnTime = pool.noteOnTimes[i];
-        oldestIndex = i;
-      }
-    }
+    bool isReleased =
+        pool.ampEnv.states[i] == envelope::EnvelopeStatus::Release;
+    scores[i] = pool.ampEnv.levels[i] * pool.velocities[i] +
+                (isReleased ? 0.0f : HELD_PENALTY);
+    quietestScore = std::min(quietestScore, scores[i]);
   }
 
+  uint32_t oldestNoteOnTime = UINT32_MAX;
+  for (uint32_t i = 0; i < MAX_VOICES; i++) {
+    // Louder voices read as UINT32_MAX (all bits set), keeps it branch-free
+    uint32_t louderBits = 0u - uint32_t{scores[i] != quietestScore};
+    oldestNoteOnTime =
+        std::min(oldestNoteOnTime, pool.noteOnTimes[i] | louderBits);
+  }
+
+  // Bounded: a NaN score matches nothing, then the last voice goes
+  uint32_t voiceIndex = 0;
+  while (voiceIndex < MAX_VOICES - 1 &&
+         (scores[voiceIndex] != quietestScore ||
+          pool.noteOnTimes[voiceIndex] != oldestNoteOnTime))
+    voiceIndex++;
+
+  return voiceIndex;
+}
+
+// Oldest voice of _candidates_ (usually a single voice)
+uint32_t findOldestVoice(const VoicePool &pool, uint64_t candidates) {
+  uint32_t oldestIndex = lowestVoice(candidates);
+
+  for (candidates &= candidates - 1; candidates;
+       candidates &= candidates - 1) {
+    uint32_t i = lowestVoice(candidates);
+    if (pool.noteOnTimes[i] < pool.noteOnTimes[oldestIndex])
+      oldestIndex = i;
+  }
+
+  return oldestIndex;
+}
+
+} // namespace
+// ==== </Allocation Helpers> ====
+
+uint32_t allocateVoiceIndex(VoicePool &pool) {
+  if (pool.freeMask)
+    return lowestVoice(pool.freeMask);
+
   // Need to cleanup otherwise it'll play twice
   // since it'll be added again after initializing voice
-  removeInactiveIndex(pool, oldestIndex);
+  removeInactiveIndex(pool, findStealVoice(pool));
 
-  return oldestIndex;
+  // The freed slot (with compactVoices, the last one, not the victim's)
+  return lowestVoice(pool.freeMask);
 }
 
 void addActiveIndex(VoicePool &pool, uint32_t voiceIndex) {
+  pool.activePositions[voiceIndex] = pool.activeCount;
   pool.activeIndices[pool.activeCount] = voiceIndex;
   pool.activeCount++;
+
+  pool.freeMask &= ~voiceBit(voiceIndex);
 }
 
-// TODO(nico): this is confusing.  there must be a better way
 void removeInactiveIndex(VoicePool &pool, uint32_t voiceIndex) {
-  uint32_t removeIndex = pool.activeCount; // out of range of active
-
-  for (uint32_t i = 0; i < pool.activeCount; i++) {
-    if (pool.activeIndices[i] == voiceIndex) {
-      removeIndex = i;
-      break;
-    }
-  }
-
-  if (removeIndex == pool.activeCount)
+  if (!pool.isActive[voiceIndex])
     return;
 
+  pool.heldNoteMasks[pool.midiNotes[voiceIndex]] &= ~voiceBit(voiceIndex);
+  pool.releasedMask &= ~voiceBit(voiceIndex);
+
   // Swap current inactive with most recent active
+  uint32_t removeIndex = pool.activePositions[voiceIndex];
   pool.activeCount--;
-  pool.activeIndices[removeIndex] = pool.activeIndices[pool.activeCount];
+  uint32_t movedIndex = pool.activeIndices[pool.activeCount];
+
+  if (pool.compactVoices && movedIndex != voiceIndex) {
+    // Move the voice itself instead: slots stay [0, activeCount)
+    moveVoice(pool, movedIndex, voiceIndex);
+    voiceIndex = movedIndex; // the slot being freed
+  } else {
+    pool.activeIndices[removeIndex] = movedIndex;
+    pool.activePositions[movedIndex] = removeIndex;
+  }
+
   pool.isActive[voiceIndex] = 0;
+  pool.freeMask |= voiceBit(voiceIndex);
 }
 
-// =========================
-// Voice Initialization
-// =========================
-
-// ==== <Initialization Helpers> ====
-namespace {
-
-bool isValidActiveIndex(uint32_t index) { return index < MAX_VOICES; }
+void retireVoice(VoicePool &pool, uint32_t voiceIndex) {
+  if (pool.ampEnv.states[voiceIndex] != envelope::EnvelopeStatus::Idle)
+    pool.earlyRetiredVoices++;
 
-uint32_t findVoiceRelease(VoicePool &pool, uint8_t midiNote) {
-  for (uint32_t i = 0; i < pool.activeCount; i++) {
-    uint32_t voiceIndex = pool.activeIndices[i];
-    if (pool.midiNotes[voiceIndex] == midiNote &&
-        pool.ampEnv.states[voiceIndex] != envelope::EnvelopeStatus::Release &&
-        pool.ampEnv.states[voiceIndex] != envelope::EnvelopeStatus::Idle) {
-
-      return voiceIndex;
-    }
-  }
-  return MAX_VOICES;
+  removeInactiveIndex(pool, voiceIndex);
 }
 
-} // namespace
-// ==== </Initialization Helpers> ====
+// =========================
+// Voice Initialization
+// =========================
 
 void initializeVoice(VoicePool &pool, uint32_t voiceIndex, uint8_t midiNote,
                      float velocity, uint32_t noteOnTime, float sampleRate) {
@@ -146,6 +323,9 @@ void initializeVoice(VoicePool &pool, uint32_t voiceIndex, uint8_t midiNote,
   // ==== Initialize Sub Oscillator ====
   oscillator::initOscillator(pool.subOsc, voiceIndex, midiNote, sampleRate);
 
+  // ==== Initialize Noise (own stream per note) ====
+  noise::initNoise(pool.noise, voiceIndex, noteOnTime);
+
   // ==== Initialize Envelopes ====
   // Amp envelope
   envelope::initEnvelope(pool.ampEnv, voiceIndex, sampleRate);
@@ -156,17 +336,24 @@ void initializeVoice(VoicePool &pool, uint32_t voiceIndex, uint8_t midiNote,
   // Mod envelope
   envelope::initEnvelope(pool.modEnv, voiceIndex, sampleRate);
 
+  // ==== Retrigger LFOs ====
+  for (LFO &lfo : pool.lfos)
+    lfo::triggerLFO(lfo, voiceIndex);
+
   // ==== Initialize Filter States ====
   filters::initSVFilter(pool.svf, voiceIndex);
   filters::initLadderFilter(pool.ladder, voiceIndex);
 }
 
 void releaseVoice(VoicePool &pool, uint8_t midiNote) {
-  uint32_t voiceIndex = findVoiceRelease(pool, midiNote);
-
-  if (!isValidActiveIndex(voiceIndex))
+  if (midiNote >= NUM_MIDI_NOTES || !pool.heldNoteMasks[midiNote])
     return;
 
+  uint32_t voiceIndex = findOldestVoice(pool, pool.heldNoteMasks[midiNote]);
+
+  pool.heldNoteMasks[midiNote] &= ~voiceBit(voiceIndex);
+  pool.releasedMask |= voiceBit(voiceIndex);
+
   envelope::triggerRelease(pool.ampEnv, voiceIndex);
   envelope::triggerRelease(pool.filterEnv, voiceIndex);
   envelope::triggerRelease(pool.modEnv, voiceIndex);
@@ -175,74 +362,150 @@ void releaseVoice(VoicePool &pool, uint8_t midiNote) {
 // Handle NoteOn Events
 void handleNoteOn(VoicePool &pool, uint8_t midiNote, float velocity,
                   uint32_t noteOnTime, float sampleRate) {
+  if (midiNote >= NUM_MIDI_NOTES)
+    return;
+
   uint32_t voiceIndex = allocateVoiceIndex(pool);
 
   initializeVoice(pool, voiceIndex, midiNote, velocity, noteOnTime, sampleRate);
 
   addActiveIndex(pool, voiceIndex);
+  pool.heldNoteMasks[midiNote] |= voiceBit(voiceIndex);
 }
 
 // ===========================
 // Voice Processing
 // ===========================
+uint32_t getRenderStages(const VoicePool &pool) {
+  const mod_matrix::ModProgram &program = pool.modMatrix.program;
+  auto isSourceOn = [&](const Oscillator &osc, ModDest mixDest) {
+    return osc.enabled &&
+           (osc.mixLevel > 0.0f || program.isDestRouted[mixDest]);
+  };
+
+  uint32_t stages = 0;
+  if (isSourceOn(pool.osc1, ModDest::Osc1Mix))
+    stages |= STAGE_OSC1;
+  if (isSourceOn(pool.osc2, ModDest::Osc2Mix))
+    stages |= STAGE_OSC2;
+  if (isSourceOn(pool.osc3, ModDest::Osc3Mix))
+    stages |= STAGE_OSC3;
+  if (isSourceOn(pool.subOsc, ModDest::SubOscMix))
+    stages |= STAGE_SUB_OSC;
+  if (pool.noise.enabled && pool.noise.mixLevel > 0.0f)
+    stages |= STAGE_NOISE;
+  if (pool.svf.enabled)
+    stages |= STAGE_SVF;
+  if (pool.ladder.enabled)
+    stages |= STAGE_LADDER;
+
+  return stages;
+}
 
 namespace {
 // ==== <Processing Helpers> ====
+constexpr uint32_t PARALLEL_MIN_VOICES = 8;
+
+constexpr ModDest PITCH_DESTS[] = {ModDest::Osc1Pitch, ModDest::Osc2Pitch,
+                                   ModDest::Osc3Pitch, ModDest::SubOscPitch};
 
-/* ==== Pre-pass: once per block, once per active voice ====
- * Advance block-rate envelopes (filterEnv, modEnv).
- * ampEnv is NOT advanced here; it runs per-sample in the hot loop below.
+/* ==== Pre-pass: once per block ====
+ * Advance block-rate envelopes (filterEnv, modEnv) and LFOs, then run the
+ * compiled mod routes (routed destinations only, each a loop across
+ * voices). ampEnv is NOT advanced here; it runs per-sample in the hot loop.
+ * Returns the render stages for this block
  * ==================================================================== */
-void preProcessBlock(VoicePool &pool, size_t numSamples) {
+uint32_t preProcessBlock(VoicePool &pool, size_t numSamples) {
   float invNumSamples = 1.0f / static_cast<float>(numSamples);
 
-  mod_matrix::clearModDestSteps(pool.modMatrix);
+  ModMatrix &matrix = pool.modMatrix;
+  mod_matrix::compileRoutes(matrix);
+  const mod_matrix::ModProgram &program = matrix.program;
+  const uint32_t stages = getRenderStages(pool);
 
-  for (uint32_t i = pool.activeCount; i > 0; i--) {
-    uint32_t voiceIndex = pool.activeIndices[i - 1];
-
-    // Set initial modulation source values
-    float modSrcs[ModSrc::SRC_COUNT] = {};
+  // ==== LFOs: global ones evaluated here, once for every voice ====
+  float blockSeconds = static_cast<float>(numSamples) * pool.invSampleRate;
+  float lfoIncrements[lfo::NUM_LFOS];
+  float globalLFOValues[lfo::NUM_LFOS];
+  bool isVoiceLFO[lfo::NUM_LFOS];
 
-    // NOTE(nico): since this is processed in the main loop it's setting the
-    // last value of the PRIOR block on first run; should be fine for now
-    modSrcs[ModSrc::AmpEnv] =
-        pool.ampEnv.levels[voiceIndex]; // processed in main loop
+  for (uint32_t l = 0; l < lfo::NUM_LFOS; l++) {
+    LFO &lfo = pool.lfos[l];
+    lfoIncrements[l] = lfo::getFrequency(lfo, pool.tempoBpm) * blockSeconds;
+    globalLFOValues[l] = lfo::processGlobalLFO(lfo, lfoIncrements[l]);
 
-    modSrcs[ModSrc::FilterEnv] =
-        envelope::processEnvelope(pool.filterEnv, voiceIndex);
+    // Unrouted per-voice LFOs skip their per-voice work
+    isVoiceLFO[l] = lfo.perVoice && program.isSrcUsed[ModSrc::LFO1 + l];
+  }
 
-    modSrcs[ModSrc::ModEnv] =
-        envelope::processEnvelope(pool.modEnv, voiceIndex);
+  // ==== Sources: one row per source, dense over active voices ====
+  const uint32_t numVoices = pool.activeCount;
+  const uint32_t *voiceIndices = pool.activeIndices;
+  mod_matrix::ModSrcValues srcValues;
+
+  for (uint32_t i = 0; i < numVoices; i++) {
+    uint32_t voiceIndex = voiceIndices[i];
+
+    // NOTE: ampEnv is processed in the main loop, so this is the last value
+    // of the PRIOR block (on the first block too); fine for modulation
+    srcValues[ModSrc::AmpEnv][i] = pool.ampEnv.levels[voiceIndex];
+
+    // Stateful: advance whether routed or not. The whole block at once,
+    // so their times are in real milliseconds like the amp envelope's
+    srcValues[ModSrc::FilterEnv][i] =
+        envelope::advanceEnvelope(pool.filterEnv, voiceIndex, numSamples);
+    srcValues[ModSrc::ModEnv][i] =
+        envelope::advanceEnvelope(pool.modEnv, voiceIndex, numSamples);
+
+    for (uint32_t l = 0; l < lfo::NUM_LFOS; l++) {
+      srcValues[ModSrc::LFO1 + l][i] =
+          isVoiceLFO[l] ? lfo::processVoiceLFO(pool.lfos[l], voiceIndex,
+                                               lfoIncrements[l])
+                        : globalLFOValues[l];
+    }
 
-    modSrcs[ModSrc::Velocity] = pool.velocities[voiceIndex];
+    srcValues[ModSrc::Velocity][i] = pool.velocities[voiceIndex];
 
-    // Accumulate mod destinations
-    float modDests[ModDest::DEST_COUNT] = {};
+    if (program.isSrcUsed[ModSrc::Noise])
+      srcValues[ModSrc::Noise][i] =
+          noise::processNoiseMod(pool.noise, voiceIndex);
+  }
 
-    for (uint8_t r = 0; r < pool.modMatrix.count; r++) {
-      const ModRoute &route = pool.modMatrix.routes[r];
+  // ==== Destinations: routed ones only ====
+  mod_matrix::evaluateRoutes(matrix, srcValues, voiceIndices, numVoices);
 
-      if (route.src == ModSrc::NoSrc || route.dest == ModDest::NoDest)
-        continue;
+  for (uint32_t i = 0; i < numVoices; i++) {
+    uint32_t voiceIndex = voiceIndices[i];
 
-      modDests[route.dest] += modSrcs[route.src] * route.amount;
+    // Interpolation setup for fast destinations (pitch)
+    for (ModDest dest : PITCH_DESTS) {
+      if (program.isDestRouted[dest])
+        mod_matrix::setModDestStep(matrix, dest, voiceIndex, invNumSamples);
     }
 
-    // Set modulation destination values
-    for (int d = 0; d < ModDest::DEST_COUNT; d++)
-      pool.modMatrix.destValues[d][voiceIndex] = modDests[d];
-
-    // Interpolation setup for fast destinations (pitch)
-    mod_matrix::setModDestStep(pool.modMatrix, ModDest::Osc1Pitch, voiceIndex,
-                               invNumSamples);
-    mod_matrix::setModDestStep(pool.modMatrix, ModDest::Osc2Pitch, voiceIndex,
-                               invNumSamples);
-    mod_matrix::setModDestStep(pool.modMatrix, ModDest::Osc3Pitch, voiceIndex,
-                               invNumSamples);
-    mod_matrix::setModDestStep(pool.modMatrix, ModDest::SubOscPitch, voiceIndex,
-                               invNumSamples);
+    // Filter coefficients (tan/sin) once per block instead of per sample
+    if (stages & STAGE_SVF)
+      filters::updateSVFVoiceCoeffs(
+          pool.svf, voiceIndex,
+          filters::computeEffectiveCutoff(
+              pool.svf.cutoff,
+              matrix.destValues[ModDest::SVFCutoff][voiceIndex]),
+          pool.svf.resonance +
+              matrix.destValues[ModDest::SVFResonance][voiceIndex],
+          pool.invSampleRate);
+
+    if (stages & STAGE_LADDER)
+      filters::updateLadderVoiceCoeffs(
+          pool.ladder, voiceIndex,
+          filters::computeEffectiveCutoff(
+              pool.ladder.cutoff,
+              matrix.destValues[ModDest::LadderCutoff][voiceIndex]),
+          pool.ladder.resonance +
+              matrix.destValues[ModDest::LadderResonance][voiceIndex],
+          pool.invSampleRate);
   }
+
+  return stages;
 };
 
 // Calculate interpolation for pitch increment (hot-loop)
@@ -258,44 +521,47 @@ float interpolatePitchInc(Oscillator &osc, ModMatrix &matrix, ModDest dest,
          dsp::math::semitonesToFreqRatio(pitchMod);
 }
 
+// One modulated oscillator sample (interpolated pitch, mix mod)
+float processModulatedOscillator(Oscillator &osc, ModMatrix &matrix,
+                                 ModDest pitchDest, ModDest mixDest,
+                                 uint32_t voiceIndex, uint32_t sampleIndex) {
+  float phaseInc =
+      interpolatePitchInc(osc, matrix, pitchDest, voiceIndex, sampleIndex);
+  float mixLevel = osc.mixLevel + matrix.destValues[mixDest][voiceIndex];
+  return oscillator::processOscillator(osc, voiceIndex, phaseInc, mixLevel);
+}
+
 // Process Oscillators with interpolation and mix (sum) values
+template <uint32_t STAGES>
 float processAndMixOscillators(VoicePool &pool, uint32_t voiceIndex,
                                uint32_t sampleIndex) {
-  // Oscillator 1
-  float osc1PhaseInc = interpolatePitchInc(
-      pool.osc1, pool.modMatrix, ModDest::Osc1Pitch, voiceIndex, sampleIndex);
-  float osc1MixLevel = pool.osc1.mixLevel +
-                       pool.modMatrix.destValues[ModDest::Osc1Mix][voiceIndex];
-  float osc1 = oscillator::processOscillator(pool.osc1, voiceIndex,
-                                             osc1PhaseInc, osc1MixLevel);
-
-  // Oscillator 2
-  float osc2PhaseInc = interpolatePitchInc(
-      pool.osc2, pool.modMatrix, ModDest::Osc2Pitch, voiceIndex, sampleIndex);
-  float osc2MixLevel = pool.osc2.mixLevel +
-                       pool.modMatrix.destValues[ModDest::Osc2Mix][voiceIndex];
-  float osc2 = oscillator::processOscillator(pool.osc2, voiceIndex,
-                                             osc2PhaseInc, osc2MixLevel);
-
-  // Oscillator 3
-  float osc3PhaseInc = interpolatePitchInc(
-      pool.osc3, pool.modMatrix, ModDest::Osc3Pitch, voiceIndex, sampleIndex);
-  float osc3MixLevel = pool.osc3.mixLevel +
-                       pool.modMatrix.destValues[ModDest::Osc3Mix][voiceIndex];
-  float osc3 = oscillator::processOscillator(pool.osc3, voiceIndex,
-                                             osc3PhaseInc, osc3MixLevel);
-
-  // Sub Oscillator
-  float subOscPhaseInc =
-      interpolatePitchInc(pool.subOsc, pool.modMatrix, ModDest::SubOscPitch,
-                          voiceIndex, sampleIndex);
-  float subOscMixLevel =
-      pool.subOsc.mixLevel +
-      pool.modMatrix.destValues[ModDest::SubOscMix][voiceIndex];
-  float subOsc = oscillator::processOscillator(pool.subOsc, voiceIndex,
-                                               subOscPhaseInc, subOscMixLevel);
-
-  return (osc1 + osc2 + osc3 + subOsc) * pool.oscMixGain;
+  ModMatrix &matrix = pool.modMatrix;
+  float sum = 0.0f;
+
+  if constexpr ((STAGES & STAGE_OSC1) != 0)
+    sum += processModulatedOscillator(pool.osc1, matrix, ModDest::Osc1Pitch,
+                                      ModDest::Osc1Mix, voiceIndex,
+                                      sampleIndex);
+
+  if constexpr ((STAGES & STAGE_OSC2) != 0)
+    sum += processModulatedOscillator(pool.osc2, matrix, ModDest::Osc2Pitch,
+                                      ModDest::Osc2Mix, voiceIndex,
+                                      sampleIndex);
+
+  if constexpr ((STAGES & STAGE_OSC3) != 0)
+    sum += processModulatedOscillator(pool.osc3, matrix, ModDest::Osc3Pitch,
+                                      ModDest::Osc3Mix, voiceIndex,
+                                      sampleIndex);
+
+  if constexpr ((STAGES & STAGE_SUB_OSC) != 0)
+    sum += processModulatedOscillator(pool.subOsc, matrix,
+                                      ModDest::SubOscPitch, ModDest::SubOscMix,
+                                      voiceIndex, sampleIndex);
+
+  if constexpr ((STAGES & STAGE_NOISE) != 0)
+    sum += noise::processNoise(pool.noise, voiceIndex, pool.noise.mixLevel);
+
+  return sum * pool.oscMixGain;
 }
 
 /* ==== Post-block: Update prevDestValues with current value ====
@@ -319,14 +585,13 @@ void postProcessBlock(VoicePool &pool) {
   }
 }
 
-//==== </Processing Helpers> ====
-} // namespace
-
-void processVoices(VoicePool &pool, float *output, size_t numSamples) {
-
-  // ==== Set and process Mod Matrix values (per-block) ====
-  preProcessBlock(pool, numSamples);
-
+/* ==== Sample-outer (original ordering) ====
+ * Every voice advances one sample at a time. Kept as the reference path
+ * and for benchmarking against the block pipeline
+ * ======================================================================== */
+template <uint32_t STAGES>
+void processVoicesPerSample(VoicePool &pool, float *output,
+                            size_t numSamples) {
   // ==== Calculate each sample value (per sample) ====
   for (uint32_t sampleIndex = 0; sampleIndex < numSamples; sampleIndex++) {
     float sample = 0.0f;
@@ -336,34 +601,20 @@ void processVoices(VoicePool &pool, float *output, size_t numSamples) {
     for (uint32_t i = pool.activeCount; i > 0; i--) {
       uint32_t voiceIndex = pool.activeIndices[i - 1];
 
-      // Process osc1, osc2, osc3, and subOsc
+      // Process osc1, osc2, osc3, subOsc and noise
       // interpolate modulation values and mix
-      float mixedOscs = processAndMixOscillators(pool, voiceIndex, sampleIndex);
+      float filtered =
+          processAndMixOscillators<STAGES>(pool, voiceIndex, sampleIndex);
 
-      // Process SVF with modulation
-      float svfModCutoff = filters::computeEffectiveCutoff(
-          pool.svf.cutoff,
-          pool.modMatrix.destValues[ModDest::SVFCutoff][voiceIndex]);
-      float svfModResonance =
-          pool.svf.resonance +
-          pool.modMatrix.destValues[ModDest::SVFResonance][voiceIndex];
-
-      // Process SVF Filter
-      float filtered = filters::processSVFilter(pool.svf, mixedOscs, voiceIndex,
-                                                svfModCutoff, svfModResonance,
-                                                pool.invSampleRate);
-
-      // Process Ladder with modulation
-      float ladderModCutoff = filters::computeEffectiveCutoff(
-          pool.ladder.cutoff,
-          pool.modMatrix.destValues[ModDest::LadderCutoff][voiceIndex]);
-      float ladderModResonance =
-          pool.ladder.resonance +
-          pool.modMatrix.destValues[ModDest::LadderResonance][voiceIndex];
-      // Process Ladder Filter
-      filtered = filters::processLadderFilter(
-          pool.ladder, filtered, voiceIndex, ladderModCutoff,
-          ladderModResonance, pool.invSampleRate);
+      // Process SVF Filter (per-block modulated coefficients)
+      if constexpr ((STAGES & STAGE_SVF) != 0)
+        filtered = filters::processSVFilter(pool.svf, filtered, voiceIndex,
+                                            sampleIndex, numSamples);
+
+      // Process Ladder Filter (per-block modulated coefficient)
+      if constexpr ((STAGES & STAGE_LADDER) != 0)
+        filtered = filters::processLadderFilter(
+            pool.ladder, filtered, voiceIndex, sampleIndex, numSamples);
 
       // TODO(nico): Implement Saturator
       // ==== Apply saturation ====
@@ -372,20 +623,275 @@ void processVoices(VoicePool &pool, float *output, size_t numSamples) {
       // Process Amp Envelope
       float ampEnv = envelope::processEnvelope(pool.ampEnv, voiceIndex);
 
-      // Check if amplitude envelope completed - remove immediately
-      if (pool.ampEnv.states[voiceIndex] == envelope::EnvelopeStatus::Idle) {
-        removeInactiveIndex(pool, voiceIndex);
+      sample += filtered * ampEnv * pool.velocities[voiceIndex] * VOICE_GAIN;
+
+      // Check if amplitude envelope completed - remove immediately.
+      // Last use of voiceIndex: with compactVoices the slot now holds the
+      // moved voice
+      if (isVoiceFinished(pool, voiceIndex)) {
+        retireVoice(pool, voiceIndex);
         // No index adjustment needed - iterating backwards
       }
-
-      sample += filtered * ampEnv * pool.velocities[voiceIndex] * VOICE_GAIN;
     }
 
-    // TODO(nico): Basic soft clip for now.
-    // Mainly for protection and not as an effect
-    output[sampleIndex] = dsp::effects::softClipFast(sample * pool.masterGain);
+    output[sampleIndex] = sample;
+  }
+}
+
+/* ==== Voice-outer (block pipeline) ====
+ * Each voice renders its whole block one stage at a time into scratch
+ * buffers (oscillators -> SVF -> ladder -> amp env) and is then summed.
+ * Per-voice state stays in registers for a stage and each loop runs over
+ * contiguous samples
+ * ======================================================================== */
+// Oscillator block with its pitch (interpolated) and mix modulation
+void processOscillatorBlock(Oscillator &osc, const ModMatrix &matrix,
+                            ModDest pitchDest, ModDest mixDest,
+                            uint32_t voiceIndex, float *buffer,
+                            size_t numSamples) {
+  oscillator::processOscillatorBlock(
+      osc, voiceIndex, matrix.prevDestValues[pitchDest][voiceIndex],
+      matrix.destStepValues[pitchDest][voiceIndex],
+      osc.mixLevel + matrix.destValues[mixDest][voiceIndex], buffer,
+      numSamples);
+}
+
+// Peak below SILENCE_EPSILON
+bool isBlockSilent(const float *buffer, size_t numSamples) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < numSamples; i++)
+    peak = std::max(peak, std::abs(buffer[i]));
+
+  return peak < SILENCE_EPSILON;
+}
+
+template <uint32_t STAGES>
+void renderVoiceBlock(VoicePool &pool, uint32_t voiceIndex, float *buffer,
+                      size_t numSamples) {
+  const ModMatrix &matrix = pool.modMatrix;
+
+  for (size_t i = 0; i < numSamples; i++)
+    buffer[i] = 0.0f;
+
+  // ==== Oscillators (summed into buffer) ====
+  if constexpr ((STAGES & STAGE_OSC1) != 0)
+    processOscillatorBlock(pool.osc1, matrix, ModDest::Osc1Pitch,
+                           ModDest::Osc1Mix, voiceIndex, buffer, numSamples);
+  if constexpr ((STAGES & STAGE_OSC2) != 0)
+    processOscillatorBlock(pool.osc2, matrix, ModDest::Osc2Pitch,
+                           ModDest::Osc2Mix, voiceIndex, buffer, numSamples);
+  if constexpr ((STAGES & STAGE_OSC3) != 0)
+    processOscillatorBlock(pool.osc3, matrix, ModDest::Osc3Pitch,
+                           ModDest::Osc3Mix, voiceIndex, buffer, numSamples);
+  if constexpr ((STAGES & STAGE_SUB_OSC) != 0)
+    processOscillatorBlock(pool.subOsc, matrix, ModDest::SubOscPitch,
+                           ModDest::SubOscMix, voiceIndex, buffer,
+                           numSamples);
+
+  // ==== Noise ====
+  if constexpr ((STAGES & STAGE_NOISE) != 0)
+    noise::processNoiseBlock(pool.noise, voiceIndex, pool.noise.mixLevel,
+                             buffer, numSamples);
+
+  for (size_t i = 0; i < numSamples; i++)
+    buffer[i] *= pool.oscMixGain;
+
+  // Silent input into a filter that has rung out would come out silent
+  // too (e.g. every source mixed down to 0): skip the filter
+  bool isInputSilent = false;
+  if constexpr ((STAGES & (STAGE_SVF | STAGE_LADDER)) != 0)
+    isInputSilent = isBlockSilent(buffer, numSamples);
+
+  // ==== SVF ====
+  if constexpr ((STAGES & STAGE_SVF) != 0) {
+    if (!isInputSilent ||
+        !filters::settleSVFVoice(pool.svf, voiceIndex, SILENCE_EPSILON))
+      filters::processSVFilterBlock(pool.svf, buffer, numSamples, voiceIndex);
   }
 
+  // ==== Ladder ====
+  if constexpr ((STAGES & STAGE_LADDER) != 0) {
+    if (!isInputSilent ||
+        !filters::settleLadderVoice(pool.ladder, voiceIndex, SILENCE_EPSILON))
+      filters::processLadderFilterBlock(pool.ladder, buffer, numSamples,
+                                        voiceIndex);
+  }
+}
+
+// Render one voice and ADD it (amp env + velocity applied) into _mix_
+template <uint32_t STAGES>
+void mixVoiceBlock(VoicePool &pool, uint32_t voiceIndex, float *mix,
+                   size_t numSamples) {
+  float voiceBuffer[ENGINE_BLOCK_SIZE];
+  float ampBuffer[ENGINE_BLOCK_SIZE];
+
+  renderVoiceBlock<STAGES>(pool, voiceIndex, voiceBuffer, numSamples);
+  envelope::processEnvelopeBlock(pool.ampEnv, voiceIndex, ampBuffer,
+                                 numSamples);
+
+  float velocity = pool.velocities[voiceIndex];
+  for (size_t s = 0; s < numSamples; s++)
+    mix[s] += voiceBuffer[s] * ampBuffer[s] * velocity * VOICE_GAIN;
+}
+
+// ADDS every active voice into _mix_, retiring finished voices as it goes
+template <uint32_t STAGES>
+void processVoicesBlock(VoicePool &pool, float *mix, size_t numSamples) {
+  // Iterating backwards so finished voices can be swapped out in place
+  for (uint32_t i = pool.activeCount; i > 0; i--) {
+    uint32_t voiceIndex = pool.activeIndices[i - 1];
+
+    mixVoiceBlock<STAGES>(pool, voiceIndex, mix, numSamples);
+
+    // Amp envelope completed, or released and inaudible
+    if (isVoiceFinished(pool, voiceIndex))
+      retireVoice(pool, voiceIndex);
+  }
+}
+
+/* ==== Voice-outer across the worker pool ====
+ * activeIndices is strided across participants (audio thread + workers),
+ * each mixing into its own partial buffer. Voices are only retired after
+ * every participant is done, so activeIndices is read-only during the job
+ * ======================================================================== */
+using MixVoiceFn = void (*)(VoicePool &, uint32_t, float *, size_t);
+
+struct ParallelBlockJob {
+  VoicePool *pool;
+  size_t numSamples;
+  MixVoiceFn mixVoice; // mixVoiceBlock for this block's stages
+};
+
+void mixVoicePartition(void *context, uint32_t participant,
+                       uint32_t numParticipants) {
+  auto *job = static_cast<ParallelBlockJob *>(context);
+  VoicePool &pool = *job->pool;
+  float *mix = pool.workerPool->partialMixes[participant];
+
+  for (size_t s = 0; s < job->numSamples; s++)
+    mix[s] = 0.0f;
+
+  for (uint32_t i = participant; i < pool.activeCount; i += numParticipants)
+    job->mixVoice(pool, pool.activeIndices[i], mix, job->numSamples);
+}
+
+void processVoicesParallel(VoicePool &pool, float *mix, size_t numSamples,
+                           MixVoiceFn mixVoice) {
+  workers::WorkerPool &workerPool = *pool.workerPool;
+
+  ParallelBlockJob job{&pool, numSamples, mixVoice};
+  workers::runJob(workerPool, mixVoicePartition, &job);
+
+  uint32_t numParticipants = workers::numParticipants(workerPool);
+  for (uint32_t p = 0; p < numParticipants; p++) {
+    const float *partial = workerPool.partialMixes[p];
+    for (size_t s = 0; s < numSamples; s++)
+      mix[s] += partial[s];
+  }
+
+  for (uint32_t i = pool.activeCount; i > 0; i--) {
+    uint32_t voiceIndex = pool.activeIndices[i - 1];
+    if (isVoiceFinished(pool, voiceIndex))
+      retireVoice(pool, voiceIndex);
+  }
+}
+
+// ==== Stage-specialized paths, indexed by the render stage mask ====
+using RenderPathFn = void (*)(VoicePool &, float *, size_t);
+
+template <uint32_t... STAGES>
+constexpr std::array<RenderPathFn, sizeof...(STAGES)>
+makePerSamplePaths(std::integer_sequence<uint32_t, STAGES...>) {
+  return {{&processVoicesPerSample<STAGES>...}};
+}
+
+template <uint32_t... STAGES>
+constexpr std::array<RenderPathFn, sizeof...(STAGES)>
+makeBlockPaths(std::integer_sequence<uint32_t, STAGES...>) {
+  return {{&processVoicesBlock<STAGES>...}};
+}
+
+template <uint32_t... STAGES>
+constexpr std::array<MixVoiceFn, sizeof...(STAGES)>
+makeMixVoicePaths(std::integer_sequence<uint32_t, STAGES...>) {
+  return {{&mixVoiceBlock<STAGES>...}};
+}
+
+using StageSequence =
+    std::make_integer_sequence<uint32_t, RENDER_STAGE_COMBINATIONS>;
+
+constexpr auto PER_SAMPLE_PATHS = makePerSamplePaths(StageSequence{});
+constexpr auto BLOCK_PATHS = makeBlockPaths(StageSequence{});
+constexpr auto MIX_VOICE_PATHS = makeMixVoicePaths(StageSequence{});
+
+#if SYNTH_HEALTH_CHECKS
+void scanMixHealth(SignalHealth &health, const float *mix,
+                   size_t numSamples) {
+  dsp::health::BlockHealth block =
+      dsp::health::scanBlock(mix, numSamples, 1.0f);
+
+  health.scannedBlocks++;
+  health.badBlocks += (block.nans | block.infs) != 0;
+  health.nanSamples += block.nans;
+  health.infSamples += block.infs;
+  health.denormalSamples += block.denormals;
+  health.clippedSamples += block.clipped;
+}
+#endif
+
+//==== </Processing Helpers> ====
+} // namespace
+
+void processVoices(VoicePool &pool, float *output, size_t numSamples) {
+  pool.renderedBlocks++;
+
+  // ==== Set and process Mod Matrix values (per-block) ====
+  // (with no voice this only advances the global LFOs)
+  uint32_t stages = preProcessBlock(pool, numSamples);
+
+  // ==== Idle pool: nothing to mix, and softClip(0) is 0 ====
+  if (pool.activeCount == 0) {
+    std::memset(output, 0, numSamples * sizeof(float));
+    pool.silentBlocks++;
+    return;
+  }
+
+  // ==== Mix (before master gain) into output ====
+  switch (pool.renderMode) {
+  case VoiceRenderMode::PerSample:
+    PER_SAMPLE_PATHS[stages](pool, output, numSamples);
+    break;
+
+  case VoiceRenderMode::Block:
+    std::memset(output, 0, numSamples * sizeof(float));
+
+    // Not worth waking the workers for a handful of voices
+    if (pool.workerPool && pool.activeCount >= PARALLEL_MIN_VOICES)
+      processVoicesParallel(pool, output, numSamples,
+                            MIX_VOICE_PATHS[stages]);
+    else
+      BLOCK_PATHS[stages](pool, output, numSamples);
+    break;
+
+  // ==== SIMD path: groups of voices across lanes ====
+  case VoiceRenderMode::Lanes:
+    std::memset(output, 0, numSamples * sizeof(float));
+    lanes::renderVoiceLanes(pool, output, numSamples, stages);
+    break;
+  }
+
+  for (size_t s = 0; s < numSamples; s++)
+    output[s] *= pool.masterGain;
+
+#if SYNTH_HEALTH_CHECKS
+  scanMixHealth(pool.health, output, numSamples);
+#endif
+
+  // TODO(nico): Basic soft clip for now.
+  // Mainly for protection and not as an effect
+  for (size_t s = 0; s < numSamples; s++)
+    output[s] = dsp::effects::softClipFast(output[s]);
+
   // Increment modulation phases
   postProcessBlock(pool);
 }
@@ -2,8 +2,11 @@
 
 #include "Envelope.h"
 #include "Filters.h"
+#include "LFO.h"
+#include "Noise.h"
 #include "Oscillator.h"
 #include "Types.h"
+#include "WorkerPool.h"
 
 #include "dsp/Waveforms.h"
 #include "synth/ModMatrix.h"
@@ -11,6 +14,16 @@
 #include <cstddef>
 #include <cstdint>
 
+// Per-block NaN/Inf/denormal/clip scan of the voice mix (SignalHealth).
+// On in debug builds; Makefile HEALTH_CHECKS=0/1 overrides
+#ifndef SYNTH_HEALTH_CHECKS
+#ifdef NDEBUG
+#define SYNTH_HEALTH_CHECKS 0
+#else
+#define SYNTH_HEALTH_CHECKS 1
+#endif
+#endif
+
 namespace synth::voices {
 using WaveformType = dsp::waveforms::WaveformType;
 
@@ -19,11 +32,27 @@ using Envelope = envelope::Envelope;
 using OscConfig = oscillator::OscConfig;
 using Oscillator = oscillator::Oscillator;
 
+using LFO = lfo::LFO;
+using NoiseGenerator = noise::NoiseGenerator;
+
 using ModMatrix = mod_matrix::ModMatrix;
 
+inline constexpr uint32_t NUM_MIDI_NOTES = 128;
+
+inline constexpr float DEFAULT_SILENCE_THRESHOLD_DB = -96.0f;
+
+// Allocation keeps one bit per voice in a uint64_t
+static_assert(MAX_VOICES == 64, "voice masks assume 64 voices");
+
 static constexpr OscConfig SUB_OSC_DEFAULT = {WaveformType::Sine, 0.5f, -2,
                                               0.0f, true};
 
+enum class VoiceRenderMode {
+  PerSample, // sample-outer, voice-inner (original ordering, reference)
+  Block,     // voice-outer: each voice renders its whole block stage by stage
+  Lanes,     // groups of voices across SIMD lanes (see VoiceLanes.h)
+};
+
 struct VoicePoolConfig {
   OscConfig osc1{};
   OscConfig osc2{};
@@ -32,6 +61,39 @@ struct VoicePoolConfig {
 
   float masterGain = 1.0f;
   float sampleRate = 48000.0f;
+  float tempoBpm = lfo::DEFAULT_TEMPO_BPM; // tempo-synced LFOs
+  uint32_t noiseSeed = noise::DEFAULT_NOISE_SEED;
+
+  VoiceRenderMode renderMode = VoiceRenderMode::Block;
+  uint32_t laneWidth = 0; // 4, 8 or 16 (0 = picked from the CPU)
+
+  // Ramp modulated filter coefficients across each block instead of
+  // stepping them at block boundaries
+  bool interpolateFilterCoeffs = false;
+
+  // Keep active voices in slots [0, activeCount): a finished voice's slot
+  // is refilled by moving the last voice's state into it, so render loops
+  // read contiguous per-voice state (lanes load instead of gathering)
+  bool compactVoices = false;
+
+  // Released voices whose gain (amp level * velocity) falls below this are
+  // retired without waiting for the release to reach 0 (-inf: never)
+  float silenceThresholdDb = DEFAULT_SILENCE_THRESHOLD_DB;
+
+  // Helper render threads for Block mode (0 = audio thread only)
+  uint32_t numWorkers = 0;
+  workers::WorkerPolicy workerPolicy = workers::WorkerPolicy::Park;
+};
+
+// Totals of the per-block scans (SYNTH_HEALTH_CHECKS builds), taken on
+// the mix after master gain, before the soft clip
+struct SignalHealth {
+  uint64_t scannedBlocks = 0;
+  uint64_t badBlocks = 0; // held a NaN or an Inf
+  uint64_t nanSamples = 0;
+  uint64_t infSamples = 0;
+  uint64_t denormalSamples = 0;
+  uint64_t clippedSamples = 0; // |x| > 1.0 (finite)
 };
 
 // VoicePool - top-level container (universal synth)
@@ -46,8 +108,8 @@ struct VoicePool {
   // TODO(nico): this needs to be tide to number of active oscs
   float oscMixGain = 1.0f / 4.0;
 
-  // TODO(nico) ==== Noise Generator ====
-  // NoiseGenerator noise;
+  // ==== Noise Generator ====
+  NoiseGenerator noise;
 
   ModMatrix modMatrix;
 
@@ -60,11 +122,9 @@ struct VoicePool {
   filters::SVFilter svf;
   filters::LadderFilter ladder;
 
-  // TODO(nico)
-  // // ====  LFOs (3 for modulation) ====
-  // LFO lfo1;
-  // LFO lfo2;
-  // LFO lfo3;
+  // ====  LFOs (ModSrc LFO1 - LFO3) ====
+  LFO lfos[lfo::NUM_LFOS];
+  float tempoBpm = lfo::DEFAULT_TEMPO_BPM;
 
   // TODO(nico)
   // // ==== Effects ====
@@ -82,30 +142,94 @@ struct VoicePool {
   float sampleRate;
   float invSampleRate;
 
+  // ==== Render mode ====
+  VoiceRenderMode renderMode = VoiceRenderMode::Block;
+  uint32_t laneWidth = 4; // voices per lane group (Lanes mode only)
+  bool compactVoices = false; // activeIndices[i] == i (see VoicePoolConfig)
+  float silenceThreshold = 0.0f; // linear (see VoicePoolConfig)
+
+  // Owned; shared by copies of the pool (see disposeVoicePool)
+  workers::WorkerPool *workerPool = nullptr;
+
   // ==== Active voice tracking ====
   uint32_t activeCount = 0;
-  uint32_t activeIndices[MAX_VOICES]; // Dense array of active indices
+  uint32_t activeIndices[MAX_VOICES];   // Dense array of active indices
+  uint32_t activePositions[MAX_VOICES]; // voice -> slot in activeIndices
+
+  // ==== Voice allocation (bit n = voice n) ====
+  uint64_t freeMask = ~uint64_t{0};            // not active
+  uint64_t heldNoteMasks[NUM_MIDI_NOTES] = {}; // note -> voices holding it
+  uint64_t releasedMask = 0;                   // note off, still sounding
+
+  // ==== Render counters (audio thread; read them once it's stopped) ====
+  uint64_t renderedBlocks = 0;     // ENGINE_BLOCK_SIZE (or shorter) blocks
+  uint64_t silentBlocks = 0;       // no active voice: memset only
+  uint64_t earlyRetiredVoices = 0; // released below silenceThreshold
+  SignalHealth health;
 };
 
+// Amp envelope done, or released and below the silence threshold
+inline bool isVoiceFinished(const VoicePool &pool, uint32_t voiceIndex) {
+  envelope::EnvelopeStatus state = pool.ampEnv.states[voiceIndex];
+  return state == envelope::EnvelopeStatus::Idle ||
+         (state == envelope::EnvelopeStatus::Release &&
+          pool.ampEnv.levels[voiceIndex] * pool.velocities[voiceIndex] <
+              pool.silenceThreshold);
+}
+
+/* ==== Render stages ====
+ * One bit per optional stage of the voice pipeline. The render paths are
+ * instantiated per combination (if constexpr), so a stage that's off this
+ * block isn't in the code that runs: no call, no branch, no phase advance.
+ */
+enum RenderStage : uint32_t {
+  STAGE_OSC1 = 1u << 0,
+  STAGE_OSC2 = 1u << 1,
+  STAGE_OSC3 = 1u << 2,
+  STAGE_SUB_OSC = 1u << 3,
+  STAGE_NOISE = 1u << 4,
+  STAGE_SVF = 1u << 5,
+  STAGE_LADDER = 1u << 6,
+};
+inline constexpr uint32_t RENDER_STAGE_COMBINATIONS = 1u << 7;
+
+// Stages that can be heard: enabled, and (sources) a mix level above 0 or
+// a mix modulation route
+uint32_t getRenderStages(const VoicePool &pool);
+
 // updating existing Engine member
+// NOT realtime safe (may start/stop worker threads)
 void updateVoicePoolConfig(VoicePool &pool, const VoicePoolConfig &config);
 
-// Find free or oldest voice index for voice Initialization
+// Stop worker threads (if any)
+void disposeVoicePool(VoicePool &pool);
+
+// Lowest free voice index, else steals one (released voices first, then
+// the quietest). Free slots are O(1); a steal walks the released voices
+// when there are a few, else is a pass over the pool
 uint32_t allocateVoiceIndex(VoicePool &pool);
 
 // Initial voice state for noteOn event
 void initializeVoice(VoicePool &pool, uint32_t index, uint8_t midiNote,
                      float velocity, uint32_t noteOnTime, float sampleRate);
 
-// Trigger envelope release for voice playing midiNote
+// Trigger envelope release for the (oldest) voice holding midiNote
 void releaseVoice(VoicePool &pool, uint8_t midiNote);
 
 // Add newly active voice (noteOn)
 void addActiveIndex(VoicePool &pool, uint32_t voiceIndex);
 
-// Remove an inactive voice (noteOff)
+// Remove an inactive (finished or stolen) voice, O(1). With compactVoices
+// the last active voice is moved into its slot, so callers iterating
+// activeIndices must go from the end (the moved voice was already visited)
 void removeInactiveIndex(VoicePool &pool, uint32_t voiceIndex);
 
+// removeInactiveIndex for a voice isVoiceFinished reported (counts the
+// early retirements)
+void retireVoice(VoicePool &pool, uint32_t voiceIndex);
+
+// Writes _numSamples_ (<= ENGINE_BLOCK_SIZE) to _output_. With no active
+// voice the block is zeroed without running the voice passes
 void processVoices(VoicePool &pool, float *output, size_t numSamples);
 
 void handleNoteOn(VoicePool &pool, uint8_t midiNote, float velocity,
@@ -0,0 +1,164 @@
+#include "WorkerPool.h"
+
+#include "dsp/Denormals.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace synth::workers {
+
+// ==== <Internal Helpers> ====
+namespace {
+// Spins before a Park worker goes to sleep (~tens of microseconds)
+constexpr uint32_t SPIN_ITERATIONS = 4096;
+
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield");
+#endif
+}
+
+// Core 0 is left to the audio thread; macOS has no hard affinity API
+void pinToCore(std::thread &thread, uint32_t core) {
+#if defined(__linux__)
+  uint32_t numCores = std::thread::hardware_concurrency();
+  if (numCores < 2)
+    return;
+
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(core % numCores, &cpuSet);
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#else
+  (void)thread;
+  (void)core;
+#endif
+}
+
+bool hasNewJob(const WorkerPool &pool, uint32_t lastGeneration) {
+  return pool.generation.load(std::memory_order_acquire) != lastGeneration ||
+         pool.isStopping.load(std::memory_order_acquire);
+}
+
+void waitForJob(WorkerPool &pool, uint32_t lastGeneration) {
+  for (uint32_t i = 0; pool.policy == WorkerPolicy::Spin ||
+                       i < SPIN_ITERATIONS;
+       i++) {
+    if (hasNewJob(pool, lastGeneration))
+      return;
+    cpuRelax();
+  }
+
+  // Park: predicate is re-checked under the lock, and runJob takes the
+  // lock before notifying, so a bump can't slip between check and wait
+  pool.parkedCount.fetch_add(1);
+  {
+    std::unique_lock<std::mutex> lock(pool.parkMutex);
+    pool.parkCondition.wait(lock, [&pool, lastGeneration] {
+      return hasNewJob(pool, lastGeneration);
+    });
+  }
+  pool.parkedCount.fetch_sub(1);
+}
+
+/* ============ (Worker Thread) ============
+ * Wait for the generation to change, run the job for this participant,
+ * then report completion
+ */
+void workerLoop(WorkerPool *pool, uint32_t participant) {
+  uint32_t lastGeneration = 0;
+
+  // Same FP mode as the audio thread's render (own thread, never restored)
+  dsp::denormals::enableFlushToZero();
+
+  while (true) {
+    waitForJob(*pool, lastGeneration);
+
+    if (pool->isStopping.load(std::memory_order_acquire))
+      return;
+
+    lastGeneration = pool->generation.load(std::memory_order_acquire);
+
+    pool->job(pool->jobContext, participant, numParticipants(*pool));
+    pool->pending.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+} // namespace
+// ==== </Internal Helpers> ====
+
+WorkerPool *createWorkerPool(uint32_t numWorkers, WorkerPolicy policy) {
+  // More participants than cores just time-slices the spinning threads
+  uint32_t numCores = std::thread::hardware_concurrency();
+  uint32_t maxWorkers = numCores > 1 ? numCores - 1 : 0;
+
+  if (maxWorkers > MAX_WORKERS)
+    maxWorkers = MAX_WORKERS;
+
+  if (numWorkers > maxWorkers)
+    numWorkers = maxWorkers;
+
+  if (!numWorkers)
+    return nullptr;
+
+  auto *pool = new WorkerPool{};
+  pool->numWorkers = numWorkers;
+  pool->policy = policy;
+
+  for (uint32_t w = 0; w < pool->numWorkers; w++) {
+    pool->threads[w] = std::thread(workerLoop, pool, w + 1);
+    pinToCore(pool->threads[w], w + 1);
+  }
+
+  return pool;
+}
+
+void destroyWorkerPool(WorkerPool *pool) {
+  if (!pool)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(pool->parkMutex);
+    pool->isStopping.store(true, std::memory_order_release);
+  }
+  pool->parkCondition.notify_all();
+
+  for (uint32_t w = 0; w < pool->numWorkers; w++) {
+    if (pool->threads[w].joinable())
+      pool->threads[w].join();
+  }
+
+  delete pool;
+}
+
+// ============ (Audio Thread) ============
+void runJob(WorkerPool &pool, JobFn job, void *context) {
+  pool.job = job;
+  pool.jobContext = context;
+  pool.pending.store(pool.numWorkers, std::memory_order_relaxed);
+
+  // Publishes job + pending to the workers
+  pool.generation.fetch_add(1);
+
+  if (pool.parkedCount.load() > 0) {
+    // Uncontended in practice: workers only hold it to re-check and sleep
+    { std::lock_guard<std::mutex> lock(pool.parkMutex); }
+    pool.parkCondition.notify_all();
+  }
+
+  job(context, 0, numParticipants(pool));
+
+  while (pool.pending.load(std::memory_order_acquire) != 0)
+    cpuRelax();
+}
+
+} // namespace synth::workers
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Types.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/* ==== Worker Pool (audio thread helpers) ====
+ * Fixed set of threads created up front; the audio thread hands them a job
+ * once per ENGINE_BLOCK_SIZE block and joins in as participant 0.
+ *
+ * Realtime rules on the audio thread (runJob):
+ *   - no allocation, no blocking waits
+ *   - job is published with a generation counter (release/acquire)
+ *   - completion is a spin on an atomic counter
+ *   - the park mutex is only touched to wake workers that are parked
+ */
+namespace synth::workers {
+inline constexpr uint32_t MAX_WORKERS = 8; // helper threads (+ audio thread)
+
+enum class WorkerPolicy {
+  Spin, // busy-wait between blocks (lowest latency, burns the cores)
+  Park, // spin briefly, then sleep until the next block
+};
+
+// participant: 0 = audio thread, 1..numWorkers = helper threads
+using JobFn = void (*)(void *context, uint32_t participant,
+                       uint32_t numParticipants);
+
+struct WorkerPool {
+  std::thread threads[MAX_WORKERS];
+  uint32_t numWorkers = 0;
+  WorkerPolicy policy = WorkerPolicy::Park;
+
+  // Per-participant partial mix (own cache lines, summed by the caller)
+  alignas(64) float partialMixes[MAX_WORKERS + 1][ENGINE_BLOCK_SIZE];
+
+  // ==== Current job (written before generation is bumped) ====
+  JobFn job = nullptr;
+  void *jobContext = nullptr;
+
+  alignas(64) std::atomic<uint32_t> generation{0};
+  alignas(64) std::atomic<uint32_t> pending{0};
+  alignas(64) std::atomic<uint32_t> parkedCount{0};
+  std::atomic<bool> isStopping{false};
+
+  std::mutex parkMutex{};
+  std::condition_variable parkCondition{};
+};
+
+/* Start _numWorkers_ helper threads (clamped to MAX_WORKERS and cores - 1),
+ * pinned to separate cores where the platform allows it. Returns nullptr
+ * if that leaves no workers.
+ * NOT realtime safe: call from setup code only
+ */
+WorkerPool *createWorkerPool(uint32_t numWorkers, WorkerPolicy policy);
+void destroyWorkerPool(WorkerPool *pool);
+
+// Run _job_ on every participant and return when all have finished
+// (audio thread safe)
+void runJob(WorkerPool &pool, JobFn job, void *context);
+
+inline uint32_t numParticipants(const WorkerPool &pool) {
+  return pool.numWorkers + 1;
+}
+
+} // namespace synth::workers
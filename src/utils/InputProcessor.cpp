@@ -27,8 +27,6 @@ namespace {
 // Parse input string and update param value
 int setInputParam(std::istringstream &iss, s_io::hSynthSession session) {
   std::string paramName;
-  float paramValue;
-
   iss >> paramName;
 
   pb::ParamMapping param = pb::findParamByName(paramName.c_str());
@@ -37,48 +35,16 @@ int setInputParam(std::istringstream &iss, s_io::hSynthSession session) {
     return 1;
   }
 
-  // Check if param is setting waveformType (string)
-  switch (param.type) {
-  // Set Oscillator Waveform
-  case pb::ParamValueType::WAVEFORM: {
-    std::string value;
-    iss >> value;
-
-    auto waveformType = pb::getWaveformType(value.c_str());
-    paramValue = static_cast<float>(waveformType);
-
-  } break;
-
-  // Enable/Disable Item
-  case pb::ParamValueType::BOOL: {
-    std::string value;
-    iss >> value;
-
-    paramValue = strcasecmp(value.c_str(), "true") == 0 ? 1.0f : 0.0f;
-
-  } break;
-
-  // Set SVF Mode
-  case pb::ParamValueType::FILTER_MODE: {
-    std::string value;
-    iss >> value;
-
-    auto filterMode = pb::getSVFModeType(value.c_str());
-    paramValue = static_cast<float>(filterMode);
-
-  } break;
-
-  // Treat all other params values as floats (denormalized)
-  default:
-    iss >> paramValue;
-  }
+  // Waveform, bool and filter mode params are entered as strings
+  float paramValue = pb::parseParamValue(param.type, iss);
 
   /*
    * NOTE(nico): User is entering denormalized value and param is stored
    * denormalized.  May consider normalizing in the future, but seems
    * pointless at this time.
    */
-  if (!s_io::setParam(session, static_cast<uint8_t>(param.id), paramValue)) {
+  if (!s_io::setParam(session, s_io::EventSource::Terminal,
+                      static_cast<uint8_t>(param.id), paramValue)) {
     printf("Warning: Param queue full, event dropped\n");
     return 2;
   }
@@ -86,6 +52,62 @@ int setInputParam(std::istringstream &iss, s_io::hSynthSession session) {
   return 0;
 }
 
+// Render load since start (or reset) plus the window since the last call
+void printCallbackStats(s_io::hSynthSession session) {
+  s_io::CallbackStats stats{};
+  s_io::getCallbackStats(session, stats);
+
+  printf("Callbacks: %llu  budget: %.3fms  avg: %.3fms  max: %.3fms\n",
+         static_cast<unsigned long long>(stats.callbackCount), stats.budgetMs,
+         stats.avgCallbackMs, stats.maxCallbackMs);
+  printf("Deadline misses: %llu  active voices: %u\n",
+         static_cast<unsigned long long>(stats.deadlineMisses),
+         stats.activeVoices);
+
+  printf("Load histogram:\n");
+  for (uint32_t b = 0; b < s_io::LOAD_HISTOGRAM_BINS; b++) {
+    if (b == s_io::LOAD_HISTOGRAM_BINS - 1)
+      printf("  >=%3u%%  %llu\n", b * 10,
+             static_cast<unsigned long long>(stats.loadHistogram[b]));
+    else
+      printf("  %3u-%3u%%  %llu\n", b * 10, b * 10 + 10,
+             static_cast<unsigned long long>(stats.loadHistogram[b]));
+  }
+
+  printf("Since last 'stats': %llu callbacks  load avg: %.1f%%  "
+         "max: %.1f%%  peak voices: %u\n",
+         static_cast<unsigned long long>(stats.recentCount),
+         stats.recentAvgLoad, stats.recentMaxLoad, stats.recentMaxVoices);
+
+  if (stats.droppedRecords)
+    printf("(%llu records dropped, ring full)\n",
+           static_cast<unsigned long long>(stats.droppedRecords));
+
+  // Event producers (one queue each)
+  printf("Event sources:\n");
+  for (uint8_t i = 0; i < static_cast<uint8_t>(s_io::EventSource::SOURCE_COUNT);
+       i++) {
+    auto source = static_cast<s_io::EventSource>(i);
+
+    s_io::ProducerStats producer{};
+    if (s_io::getProducerStats(session, source, producer))
+      continue;
+
+    printf("  %-9s notes: %llu (%llu dropped)  params: %llu (%llu dropped)\n",
+           s_io::getEventSourceName(source),
+           static_cast<unsigned long long>(producer.notesQueued),
+           static_cast<unsigned long long>(producer.notesDropped),
+           static_cast<unsigned long long>(producer.paramsQueued),
+           static_cast<unsigned long long>(producer.paramsDropped));
+  }
+
+  // Backend-side xruns (only some backends track them)
+  s_io::DriverStats driverStats{};
+  if (!s_io::getDriverStats(session, driverStats))
+    printf("Driver xruns: %llu\n",
+           static_cast<unsigned long long>(driverStats.xruns));
+}
+
 } // namespace
 
 void parseCommand(const std::string &line, Engine &engine,
@@ -132,6 +154,7 @@ void parseCommand(const std::string &line, Engine &engine,
     printf("  set <param> <value>  - Set parameter value\n");
     printf("  get <param>          - Query parameter value\n");
     printf("  list                 - List all parameters\n");
+    printf("  stats [reset]        - Show (or clear) render load stats\n");
     printf("  help                 - Show this help\n");
     printf("  quit                 - Exit\n");
     printf("\nNote commands: a-k (play notes)\n");
@@ -143,6 +166,18 @@ void parseCommand(const std::string &line, Engine &engine,
   } else if (cmd == "mod") {
     mm::parseModCommand(iss, engine.voicePool.modMatrix);
 
+    // STATS: print render load / deadline misses (stats reset clears them)
+  } else if (cmd == "stats") {
+    std::string subCmd;
+    iss >> subCmd;
+
+    if (subCmd == "reset") {
+      s_io::resetCallbackStats(session);
+      printf("OK\n");
+    } else {
+      printCallbackStats(session);
+    }
+
     // Invalid command
   } else if (cmd != "quit") {
     std::cout << "Invalid command: " << cmd << std::endl;
@@ -25,10 +25,12 @@ static void midiCallback(MidiEvent midiEvent, void *context) {
   // TODO(nico): handle more than just note on/off events
   switch (midiEvent.type) {
   case MidiEvent::Type::NoteOn:
-    synth_io::noteOn(sessionPtr, midiEvent.data1, midiEvent.data2);
+    synth_io::noteOn(sessionPtr, synth_io::EventSource::Midi, midiEvent.data1,
+                     midiEvent.data2);
     break;
   case MidiEvent::Type::NoteOff:
-    synth_io::noteOff(sessionPtr, midiEvent.data1, midiEvent.data2);
+    synth_io::noteOff(sessionPtr, synth_io::EventSource::Midi, midiEvent.data1,
+                      midiEvent.data2);
     break;
 
   default:
@@ -50,12 +52,14 @@ static void keyEventCallback(device_io::KeyEvent event, void *userContext) {
     // Note "ON" event
   } else if (event.type == device_io::KeyEventType::KeyDown) {
 
-    synth_io::noteOn(sessionPtr, asciiToMidi(event.character), 127);
+    synth_io::noteOn(sessionPtr, synth_io::EventSource::Keyboard,
+                     asciiToMidi(event.character), 127);
 
     // Note "OFF" event
   } else if (event.type == device_io::KeyEventType::KeyUp) {
 
-    synth_io::noteOff(sessionPtr, asciiToMidi(event.character), 127);
+    synth_io::noteOff(sessionPtr, synth_io::EventSource::Keyboard,
+                      asciiToMidi(event.character), 127);
   }
 
   // "ESC" to quit
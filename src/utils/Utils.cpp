@@ -27,7 +27,7 @@ float dBtoLinear(float dB) { return std::pow(10.0f, dB / 20.0f); }
 float linearToDb(float linear) {
   if (linear <= 0.0f)
     return -FLT_MAX;
-  return 20.0f * std::log10f(linear);
+  return 20.0f * std::log10(linear);
 }
 
 } // namespace synth::utils
@@ -3,6 +3,7 @@
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
@@ -134,4 +135,102 @@ void writeWavFile(const std::string &filename, std::vector<float> &audioBuffer,
   std::cout << "Play it with any audio player to hear your sine wave.\n";
 }
 
+// ==== Streaming ====
+namespace {
+int16_t bytesPerSample(SampleFormat format) {
+  return format == SampleFormat::Float32 ? 4 : 2;
+}
+
+// Same layout as writeWavMetadata + data chunk header, but with variable
+// channel count/format. Sizes are patched in closeWavStream()
+void writeStreamHeader(WavStream &stream, uint32_t dataSize) {
+  int16_t blockAlign =
+      static_cast<int16_t>(stream.numChannels * bytesPerSample(stream.format));
+
+  writeString(stream.file, "RIFF", 4);
+  writeInt32(stream.file, static_cast<int32_t>(36 + dataSize));
+  writeString(stream.file, "WAVE", 4);
+
+  writeString(stream.file, "fmt ", 4);
+  writeInt32(stream.file, 16);
+
+  // Audio format (1 = PCM, 3 = IEEE float)
+  writeInt16(stream.file, stream.format == SampleFormat::Float32 ? 3 : 1);
+  writeInt16(stream.file, stream.numChannels);
+  writeInt32(stream.file, stream.sampleRate);
+  writeInt32(stream.file, stream.sampleRate * blockAlign);
+  writeInt16(stream.file, blockAlign);
+  writeInt16(stream.file,
+             static_cast<int16_t>(bytesPerSample(stream.format) * 8));
+
+  writeString(stream.file, "data", 4);
+  writeInt32(stream.file, static_cast<int32_t>(dataSize));
+}
+} // namespace
+
+bool openWavStream(WavStream &stream, const std::string &filename,
+                   int32_t sampleRate, int16_t numChannels,
+                   SampleFormat format) {
+  stream.file = createWavFile(filename);
+  if (!stream.file)
+    return false;
+
+  stream.sampleRate = sampleRate;
+  stream.numChannels = numChannels;
+  stream.format = format;
+  stream.numFrames = 0;
+
+  writeStreamHeader(stream, 0);
+  return static_cast<bool>(stream.file);
+}
+
+void writeWavStream(WavStream &stream, const float *samples,
+                    uint32_t numFrames) {
+  size_t numSamples =
+      static_cast<size_t>(numFrames) * static_cast<size_t>(stream.numChannels);
+  size_t numBytes =
+      numSamples * static_cast<size_t>(bytesPerSample(stream.format));
+
+  if (stream.format == SampleFormat::Float32) {
+    // Already in the right format, no conversion needed
+    stream.file.write(reinterpret_cast<const char *>(samples),
+                      static_cast<std::streamsize>(numBytes));
+  } else {
+    stream.scratch.resize(numBytes);
+
+    for (size_t i = 0; i < numSamples; i++) {
+      float sampleValue = samples[i];
+
+      // Limit to valid range (-1.0 to 1.0)
+      if (sampleValue > 1.0f)
+        sampleValue = 1.0f;
+      if (sampleValue < -1.0f)
+        sampleValue = -1.0f;
+
+      int16_t pcm = static_cast<int16_t>(sampleValue * 32767.0f);
+      std::memcpy(stream.scratch.data() + i * 2, &pcm, 2);
+    }
+
+    stream.file.write(stream.scratch.data(),
+                      static_cast<std::streamsize>(numBytes));
+  }
+
+  stream.numFrames += numFrames;
+}
+
+void closeWavStream(WavStream &stream) {
+  if (!stream.file.is_open())
+    return;
+
+  uint32_t dataSize = stream.numFrames *
+                      static_cast<uint32_t>(stream.numChannels) *
+                      static_cast<uint32_t>(bytesPerSample(stream.format));
+
+  // Rewrite header now that the final size is known
+  stream.file.seekp(0);
+  writeStreamHeader(stream, dataSize);
+
+  stream.file.close();
+}
+
 } // namespace WavWriter
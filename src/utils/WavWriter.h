@@ -26,5 +26,30 @@ void writeWavMetadata(std::ofstream &file, int32_t numSamples,
 // Write WAVE file to disk
 void writeWavFile(const std::string &filename, std::vector<float> &audioBuffer,
                   int32_t sampleRate);
+
+// ==== Streaming ====
+// Header is written with placeholder sizes on open and patched on close,
+// so renders of any length can be written block by block
+enum class SampleFormat { PCM16, Float32 };
+
+struct WavStream {
+  std::ofstream file;
+  int32_t sampleRate = 0;
+  int16_t numChannels = 1;
+  SampleFormat format = SampleFormat::PCM16;
+  uint32_t numFrames = 0; // frames written so far
+
+  std::vector<char> scratch; // converted samples for a single write() call
+};
+
+bool openWavStream(WavStream &stream, const std::string &filename,
+                   int32_t sampleRate, int16_t numChannels,
+                   SampleFormat format = SampleFormat::PCM16);
+
+// _samples_ are interleaved [LRLR...], numFrames * numChannels values
+void writeWavStream(WavStream &stream, const float *samples,
+                    uint32_t numFrames);
+
+void closeWavStream(WavStream &stream);
 } // namespace WavWriter
 #endif
@@ -0,0 +1,233 @@
+/* alloc_bench.cpp
+ * Voice allocation cost per note event under bursts: the original
+ * allocator (linear scans for a free slot, the oldest voice, the voice to
+ * release and its active slot) against the VoicePool's free mask, note map
+ * and active positions.
+ *
+ * Scenarios, for bursts of n notes:
+ *   chord     n note-ons into an empty pool
+ *   release   n note-offs at once (pedal up / all notes off)
+ *   steal     n note-ons into a full pool (every one steals a voice)
+ *   stealrel  the same with every voice released (pedal up just before)
+ *
+ * Both sides pay the same voice initialization and envelope release, so
+ * the difference is the bookkeeping. Flat ns/event across n = O(1).
+ *
+ * Build:
+ *   make allocbench
+ *
+ * Usage:
+ *   ./alloc_bench [--reps n]
+ */
+
+#include "synth/Engine.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using VoicePool = synth::voices::VoicePool;
+using EnvelopeStatus = synth::envelope::EnvelopeStatus;
+
+constexpr uint32_t BURST_SIZES[] = {8, 16, 32, 64};
+constexpr float SAMPLE_RATE = 48000.0f;
+
+enum class Allocator { Legacy, Pool };
+
+// ==== The allocator VoicePool used before the masks (reference) ====
+uint32_t legacyAllocate(VoicePool &pool) {
+  uint32_t oldestIndex = synth::MAX_VOICES;
+  uint32_t oldestNoteOnTime = UINT32_MAX;
+
+  for (uint32_t i = 0; i < synth::MAX_VOICES; i++) {
+    if (!pool.isActive[i])
+      return i;
+
+    if (pool.noteOnTimes[i] < oldestNoteOnTime) {
+      oldestNoteOnTime = pool.noteOnTimes[i];
+      oldestIndex = i;
+    }
+  }
+
+  // Remove the stolen voice from the active list (linear search)
+  for (uint32_t i = 0; i < pool.activeCount; i++) {
+    if (pool.activeIndices[i] == oldestIndex) {
+      pool.activeCount--;
+      pool.activeIndices[i] = pool.activeIndices[pool.activeCount];
+      pool.isActive[oldestIndex] = 0;
+      break;
+    }
+  }
+
+  return oldestIndex;
+}
+
+void legacyNoteOn(VoicePool &pool, uint8_t midiNote, uint32_t noteOnTime) {
+  uint32_t voiceIndex = legacyAllocate(pool);
+  synth::voices::initializeVoice(pool, voiceIndex, midiNote, 100.0f,
+                                 noteOnTime, SAMPLE_RATE);
+  pool.activeIndices[pool.activeCount++] = voiceIndex;
+}
+
+void legacyNoteOff(VoicePool &pool, uint8_t midiNote) {
+  for (uint32_t i = 0; i < pool.activeCount; i++) {
+    uint32_t voiceIndex = pool.activeIndices[i];
+    if (pool.midiNotes[voiceIndex] == midiNote &&
+        pool.ampEnv.states[voiceIndex] != EnvelopeStatus::Release &&
+        pool.ampEnv.states[voiceIndex] != EnvelopeStatus::Idle) {
+      synth::envelope::triggerRelease(pool.ampEnv, voiceIndex);
+      synth::envelope::triggerRelease(pool.filterEnv, voiceIndex);
+      synth::envelope::triggerRelease(pool.modEnv, voiceIndex);
+      return;
+    }
+  }
+}
+
+// ==== Bench ====
+struct BurstResult {
+  double chordNs = 0.0;    // per note-on
+  double releaseNs = 0.0;  // per note-off
+  double stealNs = 0.0;    // per stealing note-on
+  double stealRelNs = 0.0; // per stealing note-on, released pool
+};
+
+void noteOn(Allocator allocator, VoicePool &pool, uint8_t midiNote,
+            uint32_t &noteOnTime) {
+  if (allocator == Allocator::Legacy)
+    legacyNoteOn(pool, midiNote, noteOnTime++);
+  else
+    synth::voices::handleNoteOn(pool, midiNote, 100.0f, noteOnTime++,
+                                SAMPLE_RATE);
+}
+
+void noteOff(Allocator allocator, VoicePool &pool, uint8_t midiNote) {
+  if (allocator == Allocator::Legacy)
+    legacyNoteOff(pool, midiNote);
+  else
+    synth::voices::releaseVoice(pool, midiNote);
+}
+
+// Voices finishing (untimed), the way the render loop frees them
+void clearPool(Allocator allocator, VoicePool &pool) {
+  if (allocator == Allocator::Legacy) {
+    for (uint32_t i = 0; i < pool.activeCount; i++)
+      pool.isActive[pool.activeIndices[i]] = 0;
+    pool.activeCount = 0;
+    return;
+  }
+
+  while (pool.activeCount)
+    synth::voices::removeInactiveIndex(
+        pool, pool.activeIndices[pool.activeCount - 1]);
+}
+
+// Distinct notes 24-87, then 88-127 and 1-23 for the steals
+uint8_t burstNote(uint32_t i) {
+  return static_cast<uint8_t>(1 + (23 + i) % 127);
+}
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+BurstResult runBurst(Allocator allocator, uint32_t burstSize, uint32_t reps) {
+  synth::EngineConfig engineConfig{};
+  engineConfig.sampleRate = SAMPLE_RATE;
+
+  // Engine is large (SoA arrays for every voice), keep it off the stack
+  auto *engine = new synth::Engine(synth::createEngine(engineConfig));
+  VoicePool &pool = engine->voicePool;
+
+  uint32_t noteOnTime = 0;
+  double chordSeconds = 0.0;
+  double releaseSeconds = 0.0;
+  double stealSeconds = 0.0;
+  double stealRelSeconds = 0.0;
+
+  for (uint32_t r = 0; r < reps; r++) {
+    clearPool(allocator, pool);
+
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < burstSize; i++)
+      noteOn(allocator, pool, burstNote(i), noteOnTime);
+    chordSeconds += secondsSince(start);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < burstSize; i++)
+      noteOff(allocator, pool, burstNote(i));
+    releaseSeconds += secondsSince(start);
+
+    // Fill the pool (untimed), then steal _burstSize_ voices
+    clearPool(allocator, pool);
+    for (uint32_t i = 0; i < synth::MAX_VOICES; i++)
+      noteOn(allocator, pool, burstNote(i), noteOnTime);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < burstSize; i++)
+      noteOn(allocator, pool, burstNote(synth::MAX_VOICES + i), noteOnTime);
+    stealSeconds += secondsSince(start);
+
+    // Same from a full pool of released voices
+    clearPool(allocator, pool);
+    for (uint32_t i = 0; i < synth::MAX_VOICES; i++)
+      noteOn(allocator, pool, burstNote(i), noteOnTime);
+    for (uint32_t i = 0; i < synth::MAX_VOICES; i++)
+      noteOff(allocator, pool, burstNote(i));
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < burstSize; i++)
+      noteOn(allocator, pool, burstNote(synth::MAX_VOICES + i), noteOnTime);
+    stealRelSeconds += secondsSince(start);
+  }
+
+  double numEvents = static_cast<double>(reps) * burstSize;
+  BurstResult result{};
+  result.chordNs = chordSeconds * 1e9 / numEvents;
+  result.releaseNs = releaseSeconds * 1e9 / numEvents;
+  result.stealNs = stealSeconds * 1e9 / numEvents;
+  result.stealRelNs = stealRelSeconds * 1e9 / numEvents;
+
+  synth::disposeEngine(*engine);
+  delete engine;
+  return result;
+}
+
+void printRow(const char *scenario, uint32_t burstSize, double legacyNs,
+              double poolNs) {
+  printf("%-8s %5u %12.1f %12.1f %9.2fx\n", scenario, burstSize, legacyNs,
+         poolNs, poolNs > 0.0 ? legacyNs / poolNs : 0.0);
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t reps = 20000;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+      reps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      printf("Usage: alloc_bench [--reps n]\n");
+      return 1;
+    }
+  }
+
+  printf("%u reps per burst, %u voices\n\n", reps, synth::MAX_VOICES);
+  printf("%-8s %5s %12s %12s %10s\n", "scenario", "notes", "legacy ns/ev",
+         "pool ns/ev", "speedup");
+
+  for (uint32_t burstSize : BURST_SIZES) {
+    BurstResult legacy = runBurst(Allocator::Legacy, burstSize, reps);
+    BurstResult pool = runBurst(Allocator::Pool, burstSize, reps);
+
+    printRow("chord", burstSize, legacy.chordNs, pool.chordNs);
+    printRow("release", burstSize, legacy.releaseNs, pool.releaseNs);
+    printRow("steal", burstSize, legacy.stealNs, pool.stealNs);
+    printRow("stealrel", burstSize, legacy.stealRelNs, pool.stealRelNs);
+  }
+
+  return 0;
+}
@@ -0,0 +1,480 @@
+/* dsp_bench.cpp
+ * Microbenchmarks for the dsp:: kernels and the whole Engine, with JSON
+ * output for tracking regressions between releases.
+ *
+ *   waveforms   sine/saw/square/triangle (per sample and as a block
+ *               loop, the baselines) + the wavetable block kernel
+ *   filters     processSVF, processLadder, processLadderNonlinear
+ *               (per sample) + block kernels
+ *   envelopes   processADSR (per sample) + block kernel
+ *   effects     softClip, softClipFast, saturate_* curves
+ *   engine      Engine::processAudioBlock at 1/8/32/64 voices
+ *
+ * Each result is the best of --repeats runs:
+ *   ns/sample        time per output sample (per voice for the engine)
+ *   voices/core      instances that fit in realtime on one core at the
+ *                    bench sample rate (engine: voices, not instances)
+ *
+ * Build + run:
+ *   make bench                       (writes bench_results.json)
+ *
+ * Usage:
+ *   ./dsp_bench [--json path] [--filter text] [--samples n] [--repeats n]
+ *
+ *   --json <path>    also write results as JSON ("-" = stdout, the table
+ *                    then goes to stderr)
+ *   --filter <text>  only run benchmarks whose group/name contains text
+ *   --samples <n>    samples processed per run (default 1048576)
+ *   --repeats <n>    runs per benchmark, best is kept (default 5)
+ */
+
+#include "synth/Engine.h"
+
+#include "dsp/Effects.h"
+#include "dsp/Envelope.h"
+#include "dsp/FastMath.h"
+#include "dsp/Filters.h"
+#include "dsp/Waveforms.h"
+#include "dsp/Wavetable.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr float SAMPLE_RATE = 48000.0f;
+constexpr uint32_t BLOCK_SIZE = synth::ENGINE_BLOCK_SIZE;
+constexpr uint32_t ENGINE_VOICE_COUNTS[] = {1, 8, 32, 64};
+
+struct BenchConfig {
+  const char *jsonPath = nullptr;
+  const char *filter = nullptr;
+  uint64_t numSamples = 1 << 20;
+  uint32_t repeats = 5;
+  FILE *table = stdout; // stderr when the JSON goes to stdout
+};
+
+struct BenchResult {
+  std::string group;
+  std::string name;
+  uint32_t voices = 1;
+  double nsPerSample = 0.0;
+  double voicesPerCore = 0.0;
+};
+
+float checksum = 0.0f; // keeps the optimizer honest
+
+bool isSelected(const BenchConfig &config, const char *group,
+                const char *name) {
+  if (!config.filter)
+    return true;
+
+  std::string fullName = std::string(group) + "/" + name;
+  return fullName.find(config.filter) != std::string::npos;
+}
+
+/* Best-of-repeats ns per sample for _processBlock_, called with a
+ * BLOCK_SIZE buffer until numSamples have been produced
+ */
+template <typename ProcessBlock>
+double timeBlocks(const BenchConfig &config, ProcessBlock processBlock) {
+  float buffer[BLOCK_SIZE] = {};
+  uint64_t numBlocks = config.numSamples / BLOCK_SIZE;
+  if (!numBlocks)
+    numBlocks = 1;
+
+  processBlock(buffer); // warm up (caches, lazy tables)
+
+  double best = 0.0;
+  for (uint32_t r = 0; r < config.repeats; r++) {
+    Clock::time_point start = Clock::now();
+    for (uint64_t b = 0; b < numBlocks; b++) {
+      processBlock(buffer);
+      checksum += buffer[b % BLOCK_SIZE];
+    }
+    Clock::time_point end = Clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() /
+                static_cast<double>(numBlocks * BLOCK_SIZE);
+    best = (r == 0 || ns < best) ? ns : best;
+  }
+
+  return best;
+}
+
+// How many of these fit in one core's realtime budget
+double voicesPerCore(double nsPerSample, uint32_t voices) {
+  double budget = 1e9 / static_cast<double>(SAMPLE_RATE);
+  return nsPerSample > 0.0
+             ? budget / nsPerSample * static_cast<double>(voices)
+             : 0.0;
+}
+
+template <typename ProcessBlock>
+void runKernel(const BenchConfig &config, std::vector<BenchResult> &results,
+               const char *group, const char *name,
+               ProcessBlock processBlock) {
+  if (!isSelected(config, group, name))
+    return;
+
+  BenchResult result{group, name, 1, 0.0, 0.0};
+  result.nsPerSample = timeBlocks(config, processBlock);
+  result.voicesPerCore = voicesPerCore(result.nsPerSample, 1);
+
+  fprintf(config.table, "%-10s %-24s %10.3f %12.0f\n", group, name,
+          result.nsPerSample, result.voicesPerCore);
+  results.push_back(result);
+}
+
+// ==== dsp::waveforms (+ the wavetable oscillator kernel) ====
+void benchWaveforms(const BenchConfig &config,
+                    std::vector<BenchResult> &results) {
+  using namespace dsp::waveforms;
+
+  const float inc = 440.0f / SAMPLE_RATE;
+
+  // Per-sample functions, phase advanced the way an oscillator does
+  auto perSample = [inc](float (*waveform)(float, float)) {
+    return [inc, waveform, phase = 0.0f](float *buffer) mutable {
+      for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+        buffer[i] = waveform(phase, inc);
+        phase += inc;
+        phase = phase >= 1.0f ? phase - 1.0f : phase;
+      }
+    };
+  };
+
+  runKernel(config, results, "waveforms", "sine",
+            perSample([](float p, float) { return sine(p); }));
+  runKernel(config, results, "waveforms", "saw",
+            perSample([](float p, float dt) { return saw(p, dt); }));
+  runKernel(config, results, "waveforms", "square",
+            perSample([](float p, float dt) { return square(p, dt); }));
+  runKernel(config, results, "waveforms", "triangle",
+            perSample([](float p, float) { return triangle(p); }));
+
+  float incs[BLOCK_SIZE];
+  for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+    incs[i] = inc;
+
+  // Baselines for wavetable_block: the analytic shapes as a block loop
+  // (phase in a register, shape inlined), the oscillators before wavetables
+  auto analyticBlock = [&incs](auto waveform) {
+    return [&incs, waveform, phase = 0.0f](float *buffer) mutable {
+      float p = phase;
+      for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+        buffer[i] = waveform(p, incs[i]);
+        p += incs[i];
+        p = p >= 1.0f ? p - 1.0f : p;
+      }
+      phase = p;
+    };
+  };
+
+  runKernel(config, results, "waveforms", "sine_block",
+            analyticBlock([](float p, float) { return sine(p); }));
+  runKernel(config, results, "waveforms", "saw_block",
+            analyticBlock([](float p, float dt) { return saw(p, dt); }));
+  runKernel(config, results, "waveforms", "square_block",
+            analyticBlock([](float p, float dt) { return square(p, dt); }));
+  runKernel(config, results, "waveforms", "triangle_block",
+            analyticBlock([](float p, float) { return triangle(p); }));
+
+  dsp::wavetable::initBuiltinTables();
+  const dsp::wavetable::Wavetable &sawTable =
+      dsp::wavetable::getBuiltinTable(WaveformType::Saw);
+
+  runKernel(config, results, "waveforms", "wavetable_block",
+            [&sawTable, &incs, phase = 0.0f](float *buffer) mutable {
+              std::memset(buffer, 0, sizeof(float) * BLOCK_SIZE);
+              dsp::wavetable::processWavetableBlock(sawTable, phase, incs,
+                                                    1.0f, buffer, BLOCK_SIZE);
+            });
+}
+
+// Input signal for the filters/effects: a saw with some level on it
+void fillInput(float *input) {
+  float phase = 0.0f;
+  for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+    input[i] = 2.0f * phase - 1.0f;
+    phase += 110.0f / SAMPLE_RATE;
+    phase = phase >= 1.0f ? phase - 1.0f : phase;
+  }
+}
+
+// ==== dsp::filters ====
+void benchFilters(const BenchConfig &config,
+                  std::vector<BenchResult> &results) {
+  using namespace dsp::filters;
+
+  float input[BLOCK_SIZE];
+  fillInput(input);
+
+  const SVFCoeffs svfCoeffs =
+      computeSVFCoeffs(1200.0f, 2.0f, 1.0f / SAMPLE_RATE);
+  const float ladderF =
+      2.0f * dsp::math::fastSinPi(1200.0f / SAMPLE_RATE);
+  const float ladderRes = 2.0f;
+  const float drive = 2.0f;
+
+  runKernel(config, results, "filters", "svf",
+            [&, state = SVFState{}](float *buffer) mutable {
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+                buffer[i] = processSVF(input[i], svfCoeffs, state).lp;
+            });
+  runKernel(config, results, "filters", "ladder",
+            [&, state = LadderState{}](float *buffer) mutable {
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+                buffer[i] = processLadder(input[i], ladderF, ladderRes, state);
+            });
+  runKernel(config, results, "filters", "ladder_nonlinear",
+            [&, state = LadderState{}](float *buffer) mutable {
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+                buffer[i] = processLadderNonlinear(input[i], ladderF,
+                                                   ladderRes, drive, state);
+            });
+
+  runKernel(config, results, "filters", "svf_block",
+            [&, state = SVFState{}](float *buffer) mutable {
+              std::memcpy(buffer, input, sizeof(input));
+              processSVFBlock(buffer, BLOCK_SIZE, svfCoeffs, state, 1.0f,
+                              0.0f, 0.0f);
+            });
+  runKernel(config, results, "filters", "ladder_block",
+            [&, state = LadderState{}](float *buffer) mutable {
+              std::memcpy(buffer, input, sizeof(input));
+              processLadderBlock(buffer, BLOCK_SIZE, ladderF, ladderRes,
+                                 state);
+            });
+  runKernel(config, results, "filters", "ladder_nonlinear_block",
+            [&, state = LadderState{}](float *buffer) mutable {
+              std::memcpy(buffer, input, sizeof(input));
+              processLadderNonlinearBlock(buffer, BLOCK_SIZE, ladderF,
+                                          ladderRes, drive, state);
+            });
+
+  // Coefficient setup cost (per block when modulated)
+  runKernel(config, results, "filters", "svf_coeffs",
+            [cutoff = 100.0f](float *buffer) mutable {
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+                buffer[i] =
+                    computeSVFCoeffs(cutoff, 2.0f, 1.0f / SAMPLE_RATE).a1;
+                cutoff = cutoff > 20000.0f ? 100.0f : cutoff * 1.001f;
+              }
+            });
+}
+
+// ==== dsp::envelopes ====
+// Gate held through attack/decay into sustain, then released, repeatedly
+struct ADSRBenchState {
+  dsp::envelopes::Status status = dsp::envelopes::Status::Attack;
+  float amplitude = 0.0f;
+  float progress = 0.0f;
+  float releaseStartLevel = 0.0f;
+  uint32_t blocks = 0;
+};
+
+void retriggerADSR(ADSRBenchState &st) {
+  if (++st.blocks % 32 == 16)
+    st.status = dsp::envelopes::Status::Release;
+  if (st.status == dsp::envelopes::Status::Idle)
+    st.status = dsp::envelopes::Status::Attack;
+}
+
+void benchEnvelopes(const BenchConfig &config,
+                    std::vector<BenchResult> &results) {
+  using namespace dsp::envelopes;
+
+  const float attackInc = 1.0f / (0.01f * SAMPLE_RATE);
+  const float decayInc = 1.0f / (0.1f * SAMPLE_RATE);
+  const float releaseInc = 1.0f / (0.05f * SAMPLE_RATE);
+  const float sustain = 0.7f;
+
+  runKernel(config, results, "envelopes", "adsr",
+            [=, st = ADSRBenchState{}](float *buffer) mutable {
+              retriggerADSR(st);
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+                buffer[i] = processADSR(st.status, st.amplitude, st.progress,
+                                        st.releaseStartLevel, attackInc,
+                                        decayInc, releaseInc, sustain);
+            });
+  runKernel(config, results, "envelopes", "adsr_block",
+            [=, st = ADSRBenchState{}](float *buffer) mutable {
+              retriggerADSR(st);
+              processADSRBlock(st.status, st.amplitude, st.progress,
+                               st.releaseStartLevel, attackInc, decayInc,
+                               releaseInc, sustain, buffer, BLOCK_SIZE);
+            });
+}
+
+// ==== dsp::effects ====
+void benchEffects(const BenchConfig &config,
+                  std::vector<BenchResult> &results) {
+  using namespace dsp::effects;
+
+  float input[BLOCK_SIZE];
+  fillInput(input);
+
+  auto curve = [&input](float (*saturate)(float)) {
+    return [&input, saturate](float *buffer) {
+      for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+        buffer[i] = saturate(input[i] * 2.0f);
+    };
+  };
+
+  const float drive = denormalizeDrive(0.5f);
+  const float invDrive = calcInvDrive(drive);
+
+  runKernel(config, results, "effects", "soft_clip",
+            [&](float *buffer) {
+              for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+                buffer[i] = softClip(input[i], drive, invDrive, 1.0f);
+            });
+  runKernel(config, results, "effects", "soft_clip_fast",
+            curve([](float x) { return softClipFast(x); }));
+  runKernel(config, results, "effects", "saturate_tanh",
+            curve([](float x) { return saturate_tanh(x); }));
+  runKernel(config, results, "effects", "saturate_soft",
+            curve([](float x) { return saturate_soft(x); }));
+  runKernel(config, results, "effects", "saturate_poly",
+            curve([](float x) { return saturate_poly(x); }));
+  runKernel(config, results, "effects", "saturate_asymm",
+            curve([](float x) { return saturate_asymm(x); }));
+}
+
+// ==== Whole engine (default render mode, filters swept by filterEnv) ====
+void benchEngine(const BenchConfig &config,
+                 std::vector<BenchResult> &results) {
+  for (uint32_t numVoices : ENGINE_VOICE_COUNTS) {
+    std::string name = "process_audio_block_" + std::to_string(numVoices);
+    if (!isSelected(config, "engine", name.c_str()))
+      continue;
+
+    synth::EngineConfig engineConfig{};
+    engineConfig.sampleRate = SAMPLE_RATE;
+    engineConfig.osc1.waveform = synth::WaveformType::Saw;
+    engineConfig.osc2 = {synth::WaveformType::Square, 0.5f, -1, -10.0f,
+                         true};
+    engineConfig.osc3 = {synth::WaveformType::Triangle, 0.5f, 1, 7.0f, true};
+
+    // Engine is large (SoA arrays for every voice), keep it off the stack
+    auto *engine = new synth::Engine(synth::createEngine(engineConfig));
+    engine->voicePool.svf.enabled = true;
+    engine->voicePool.ladder.enabled = true;
+    synth::mod_matrix::addRoute(engine->voicePool.modMatrix,
+                                synth::mod_matrix::ModSrc::FilterEnv,
+                                synth::mod_matrix::ModDest::SVFCutoff, 3.0f);
+
+    for (uint32_t v = 0; v < numVoices; v++) {
+      synth::NoteEvent noteOn{synth_io::NoteEventType::NoteOn,
+                              static_cast<uint8_t>(36 + v % 64), 100};
+      engine->processNoteEvent(noteOn);
+    }
+
+    double nsPerFrame = timeBlocks(config, [engine](float *buffer) {
+      float *channels[1] = {buffer};
+      engine->processAudioBlock(channels, 1, BLOCK_SIZE);
+    });
+
+    BenchResult result{"engine", name, numVoices, 0.0, 0.0};
+    result.nsPerSample = nsPerFrame / static_cast<double>(numVoices);
+    result.voicesPerCore = voicesPerCore(nsPerFrame, numVoices);
+
+    fprintf(config.table, "%-10s %-24s %10.3f %12.0f\n", "engine",
+            name.c_str(), result.nsPerSample, result.voicesPerCore);
+    results.push_back(result);
+
+    synth::disposeEngine(*engine);
+    delete engine;
+  }
+}
+
+int writeJson(const char *path, const BenchConfig &config,
+              const std::vector<BenchResult> &results) {
+  bool isStdout = strcmp(path, "-") == 0;
+  FILE *file = isStdout ? stdout : fopen(path, "w");
+  if (!file) {
+    printf("Could not open %s\n", path);
+    return 1;
+  }
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"suite\": \"dsp_bench\",\n");
+  fprintf(file, "  \"version\": 1,\n");
+  fprintf(file, "  \"sampleRate\": %.0f,\n", static_cast<double>(SAMPLE_RATE));
+  fprintf(file, "  \"blockSize\": %u,\n", BLOCK_SIZE);
+  fprintf(file, "  \"mathAccuracy\": %d,\n", DSP_MATH_ACCURACY);
+  fprintf(file, "  \"samplesPerRun\": %llu,\n",
+          static_cast<unsigned long long>(config.numSamples));
+  fprintf(file, "  \"repeats\": %u,\n", config.repeats);
+  fprintf(file, "  \"results\": [\n");
+
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchResult &r = results[i];
+    fprintf(file,
+            "    {\"group\": \"%s\", \"name\": \"%s\", \"voices\": %u, "
+            "\"nsPerSample\": %.4f, \"voicesPerCore\": %.1f}%s\n",
+            r.group.c_str(), r.name.c_str(), r.voices, r.nsPerSample,
+            r.voicesPerCore, i + 1 < results.size() ? "," : "");
+  }
+
+  fprintf(file, "  ]\n}\n");
+
+  if (!isStdout)
+    fclose(file);
+  return 0;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  BenchConfig config{};
+
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+
+    if (strcmp(argv[i], "--json") == 0 && hasValue) {
+      config.jsonPath = argv[++i];
+    } else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+      config.filter = argv[++i];
+    } else if (strcmp(argv[i], "--samples") == 0 && hasValue) {
+      config.numSamples = std::strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--repeats") == 0 && hasValue) {
+      config.repeats =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      printf("Usage: dsp_bench [--json path] [--filter text] [--samples n] "
+             "[--repeats n]\n");
+      return 1;
+    }
+  }
+
+  if (config.repeats == 0)
+    config.repeats = 1;
+
+  if (config.jsonPath && strcmp(config.jsonPath, "-") == 0)
+    config.table = stderr;
+
+  fprintf(config.table, "%-10s %-24s %10s %12s\n", "group", "benchmark",
+          "ns/sample", "voices/core");
+
+  std::vector<BenchResult> results;
+  benchWaveforms(config, results);
+  benchFilters(config, results);
+  benchEnvelopes(config, results);
+  benchEffects(config, results);
+  benchEngine(config, results);
+
+  fprintf(config.table, "\n(checksum %.4f)\n",
+          static_cast<double>(checksum));
+
+  if (config.jsonPath)
+    return writeJson(config.jsonPath, config, results);
+
+  return 0;
+}
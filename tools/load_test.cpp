@@ -0,0 +1,195 @@
+/* load_test.cpp
+ * Drives the full synth_io path (event queues + audio callback + Engine)
+ * on a headless audio backend, so it runs on machines without a sound card.
+ *
+ * Build:
+ *   make loadtest
+ *
+ * Usage:
+ *   ./load_test [--seconds n] [--notes n] [--workers n] [--file out.wav]
+ *               [--frames n] [--unpaced]
+ *
+ *   --seconds <n>   test duration (default 10)
+ *   --notes <n>     notes per chord, retriggered every 50ms (default 8)
+ *   --workers <n>   helper render threads (default 0)
+ *   --file <path>   use FileSink backend and write output to <path>
+ *   --frames <n>    frames per callback (default 512)
+ *   --unpaced       run callbacks back to back instead of in realtime
+ */
+
+#include "synth/Engine.h"
+
+#include "synth_io/Events.h"
+#include "synth_io/SynthIO.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace {
+void processParamEvent(synth_io::ParamEvent event, void *myContext) {
+  auto engine = static_cast<synth::Engine *>(myContext);
+  engine->processParamEvent(event);
+}
+
+void processNoteEvent(synth_io::NoteEvent event, void *myContext) {
+  auto engine = static_cast<synth::Engine *>(myContext);
+  engine->processNoteEvent(event);
+}
+
+void processAudioBlock(float **outputBuffer, size_t numChannels,
+                       size_t numFrames, void *myContext) {
+  auto engine = static_cast<synth::Engine *>(myContext);
+  engine->processAudioBlock(outputBuffer, numChannels, numFrames);
+}
+
+uint32_t getActiveVoices(void *myContext) {
+  auto engine = static_cast<synth::Engine *>(myContext);
+  return engine->voicePool.activeCount;
+}
+
+// Retrigger a chord every 50ms (worst case: full release tails overlapping)
+void playChords(synth_io::hSynthSession session, uint32_t notesPerChord,
+                const std::atomic<bool> &isRunning) {
+  uint8_t root = 36;
+
+  while (isRunning.load()) {
+    for (uint32_t n = 0; n < notesPerChord; n++)
+      synth_io::noteOn(session, synth_io::EventSource::Host,
+                       static_cast<uint8_t>(root + n * 3), 100);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (uint32_t n = 0; n < notesPerChord; n++)
+      synth_io::noteOff(session, synth_io::EventSource::Host,
+                        static_cast<uint8_t>(root + n * 3), 0);
+
+    root = static_cast<uint8_t>(36 + (root - 35) % 24);
+  }
+}
+
+void printStats(synth_io::hSynthSession session) {
+  synth_io::CallbackStats callbackStats{};
+  synth_io::getCallbackStats(session, callbackStats);
+
+  printf("render: avg %.1f%%  max %.1f%%  voices %u  misses: %llu\n",
+         callbackStats.recentAvgLoad, callbackStats.recentMaxLoad,
+         callbackStats.recentMaxVoices,
+         static_cast<unsigned long long>(callbackStats.deadlineMisses));
+
+  synth_io::DriverStats stats{};
+  if (synth_io::getDriverStats(session, stats))
+    return;
+
+  printf("callbacks: %llu  avg: %.3fms  max: %.3fms  budget: %.3fms  "
+         "load: %.1f%%  misses: %llu  xruns: %llu\n",
+         static_cast<unsigned long long>(stats.callbackCount),
+         stats.avgCallbackMs, stats.maxCallbackMs, stats.periodMs,
+         stats.periodMs > 0.0 ? 100.0 * stats.avgCallbackMs / stats.periodMs
+                              : 0.0,
+         static_cast<unsigned long long>(stats.deadlineMisses),
+         static_cast<unsigned long long>(stats.xruns));
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t seconds = 10;
+  uint32_t notesPerChord = 8;
+  uint32_t numWorkers = 0;
+
+  synth_io::SessionConfig sessionConfig{};
+  sessionConfig.backend = synth_io::AudioBackend::Null;
+
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+
+    if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+      seconds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--notes") == 0 && hasValue) {
+      notesPerChord =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--workers") == 0 && hasValue) {
+      numWorkers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--file") == 0 && hasValue) {
+      sessionConfig.backend = synth_io::AudioBackend::FileSink;
+      sessionConfig.outputPath = argv[++i];
+    } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+      sessionConfig.numFrames =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--unpaced") == 0) {
+      sessionConfig.realtimePacing = false;
+    } else {
+      printf("Usage: load_test [--seconds n] [--notes n] [--workers n] "
+             "[--file out.wav] [--frames n] [--unpaced]\n");
+      return 1;
+    }
+  }
+
+  synth::EngineConfig engineConfig{};
+  engineConfig.sampleRate = static_cast<float>(sessionConfig.sampleRate);
+  engineConfig.numFrames = sessionConfig.numFrames;
+  engineConfig.numWorkers = numWorkers;
+  engineConfig.osc1.waveform = synth::WaveformType::Saw;
+  engineConfig.osc2 = {synth::WaveformType::Square, 0.5f, -1, -10.0f, true};
+
+  synth::Engine engine = synth::createEngine(engineConfig);
+
+  synth_io::SynthCallbacks sessionCallbacks{};
+  sessionCallbacks.processAudioBlock = processAudioBlock;
+  sessionCallbacks.processNoteEvent = processNoteEvent;
+  sessionCallbacks.processParamEvent = processParamEvent;
+  sessionCallbacks.getActiveVoices = getActiveVoices;
+
+  synth_io::hSynthSession session =
+      synth_io::initSession(sessionConfig, sessionCallbacks, &engine);
+
+  if (!session) {
+    printf("Unable to initialize audio session\n");
+    synth::disposeEngine(engine);
+    return 1;
+  }
+
+  synth_io::startSession(session);
+
+  std::atomic<bool> isRunning{true};
+  std::thread producer(playChords, session, notesPerChord,
+                       std::cref(isRunning));
+
+  for (uint32_t s = 0; s < seconds; s++) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    printStats(session);
+  }
+
+  isRunning.store(false);
+  producer.join();
+
+  synth_io::stopSession(session);
+  printStats(session);
+
+  // Audio thread stopped, the engine's counters are safe to read
+  const synth::VoicePool &pool = engine.voicePool;
+  printf("silent blocks: %llu of %llu  voices retired early: %llu\n",
+         static_cast<unsigned long long>(pool.silentBlocks),
+         static_cast<unsigned long long>(pool.renderedBlocks),
+         static_cast<unsigned long long>(pool.earlyRetiredVoices));
+
+#if SYNTH_HEALTH_CHECKS
+  printf("health: bad blocks %llu of %llu  NaN %llu  Inf %llu  "
+         "denormal %llu  clipped %llu\n",
+         static_cast<unsigned long long>(pool.health.badBlocks),
+         static_cast<unsigned long long>(pool.health.scannedBlocks),
+         static_cast<unsigned long long>(pool.health.nanSamples),
+         static_cast<unsigned long long>(pool.health.infSamples),
+         static_cast<unsigned long long>(pool.health.denormalSamples),
+         static_cast<unsigned long long>(pool.health.clippedSamples));
+#endif
+
+  synth_io::disposeSession(session);
+  synth::disposeEngine(engine);
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+/* offline_render.cpp
+ * Headless renderer: plays a score through synth::Engine and writes a WAV.
+ * No audio device required (runs on any platform with a C++17 compiler).
+ *
+ * Build:
+ *   make render
+ *
+ * Usage:
+ *   ./offline_render <score.txt> <output.wav> [options]
+ *
+ * Options:
+ *   --rate <hz>        sample rate (default 48000)
+ *   --channels <n>     output channels (default 2)
+ *   --block <frames>   frames per engine call (default 512, max 16384)
+ *   --tail <seconds>   render time after last event if no 'end' (default 2)
+ *   --pcm16            16-bit PCM output (default 32-bit float)
+ *   --workers <n>      helper render threads (default 0)
+ *   --lanes <width>    render voices in SIMD lane groups of 4/8/16
+ *                      (0 = picked from the CPU)
+ *   --compact          keep active voices in the lowest slots
+ *   --interp-filters   ramp modulated filter coefficients across each block
+ *   --silence <db>     retire released voices quieter than this
+ *                      (default -96, -inf = wait for the release to end)
+ */
+
+#include "render/OfflineRenderer.h"
+#include "synth/Engine.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+void printUsage() {
+  printf("Usage: offline_render <score.txt> <output.wav> [--rate hz] "
+         "[--channels n] [--block frames] [--tail seconds] [--pcm16] "
+         "[--workers n] [--lanes width] [--compact] [--interp-filters] "
+         "[--silence db]\n");
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  using namespace synth;
+
+  if (argc < 3) {
+    printUsage();
+    return 1;
+  }
+
+  std::string scorePath = argv[1];
+  std::string outputPath = argv[2];
+
+  float sampleRate = 48000.0f;
+  float tailSeconds = 2.0f;
+  render::RenderConfig renderConfig{};
+  EngineConfig engineConfig{};
+
+  for (int i = 3; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+
+    if (strcmp(argv[i], "--rate") == 0 && hasValue) {
+      sampleRate = std::strtof(argv[++i], nullptr);
+    } else if (strcmp(argv[i], "--channels") == 0 && hasValue) {
+      renderConfig.numChannels =
+          static_cast<uint16_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--block") == 0 && hasValue) {
+      renderConfig.blockSize =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--tail") == 0 && hasValue) {
+      tailSeconds = std::strtof(argv[++i], nullptr);
+    } else if (strcmp(argv[i], "--pcm16") == 0) {
+      renderConfig.sampleFormat = render::SampleFormat::PCM16;
+    } else if (strcmp(argv[i], "--workers") == 0 && hasValue) {
+      engineConfig.numWorkers =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--lanes") == 0 && hasValue) {
+      engineConfig.renderMode = voices::VoiceRenderMode::Lanes;
+      engineConfig.laneWidth =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--compact") == 0) {
+      engineConfig.compactVoices = true;
+    } else if (strcmp(argv[i], "--interp-filters") == 0) {
+      engineConfig.interpolateFilterCoeffs = true;
+    } else if (strcmp(argv[i], "--silence") == 0 && hasValue) {
+      engineConfig.silenceThresholdDb = std::strtof(argv[++i], nullptr);
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  if (sampleRate <= 0.0f) {
+    printf("Invalid sample rate\n");
+    return 1;
+  }
+
+  engineConfig.sampleRate = sampleRate;
+
+  Engine engine = createEngine(engineConfig);
+
+  std::vector<render::RenderEvent> events;
+  uint64_t endFrame = 0;
+
+  if (render::loadScore(scorePath, engine, events, endFrame)) {
+    disposeEngine(engine);
+    return 2;
+  }
+
+  if (!endFrame) {
+    uint64_t lastFrame = events.empty() ? 0 : events.back().frame;
+    endFrame = lastFrame + static_cast<uint64_t>(tailSeconds * sampleRate);
+  }
+
+  render::RenderStats stats{};
+  if (render::renderToFile(engine, events.data(), events.size(), endFrame,
+                           outputPath, renderConfig, stats)) {
+    disposeEngine(engine);
+    return 3;
+  }
+
+  printf("Rendered %llu frames (%llu blocks) in %.3fs: %.1fx realtime\n",
+         static_cast<unsigned long long>(stats.framesRendered),
+         static_cast<unsigned long long>(stats.blocksRendered),
+         stats.elapsedSeconds, stats.realtimeFactor);
+  printf("Silent engine blocks: %llu of %llu, voices retired early: %llu\n",
+         static_cast<unsigned long long>(stats.silentBlocks),
+         static_cast<unsigned long long>(stats.engineBlocks),
+         static_cast<unsigned long long>(stats.earlyRetiredVoices));
+
+#if SYNTH_HEALTH_CHECKS
+  const voices::SignalHealth &health = engine.voicePool.health;
+  printf("Health: %llu bad blocks of %llu, NaN %llu, Inf %llu, "
+         "denormal %llu, clipped %llu samples\n",
+         static_cast<unsigned long long>(health.badBlocks),
+         static_cast<unsigned long long>(health.scannedBlocks),
+         static_cast<unsigned long long>(health.nanSamples),
+         static_cast<unsigned long long>(health.infSamples),
+         static_cast<unsigned long long>(health.denormalSamples),
+         static_cast<unsigned long long>(health.clippedSamples));
+#endif
+
+  disposeEngine(engine);
+  return 0;
+}
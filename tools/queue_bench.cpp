@@ -0,0 +1,205 @@
+/* queue_bench.cpp
+ * Event queue throughput: the original NoteEventQueue (seq_cst, indices
+ * sharing a cache line with the events) against SpscQueue (acquire/release,
+ * cached indices, padded) with single and batch pop.
+ *
+ * Traffic is bursty, the way MIDI chords and automation sweeps arrive: the
+ * producer pushes a burst, the consumer (the audio thread's role) drains
+ * whatever is queued, repeat.
+ *
+ * Build:
+ *   make queuebench
+ *
+ * Usage:
+ *   ./queue_bench [--events n]
+ */
+
+#include "SpscQueue.h"
+
+#include "synth_io/Events.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using NoteEvent = synth_io::NoteEvent;
+
+constexpr size_t QUEUE_SIZE = 256;
+
+// The queue synth_io used before SpscQueue (reference)
+struct LegacyQueue {
+  static constexpr size_t SIZE{QUEUE_SIZE};
+  static constexpr size_t WRAP{SIZE - 1};
+
+  NoteEvent queue[SIZE];
+
+  std::atomic<size_t> readIndex{0};
+  std::atomic<size_t> writeIndex{0};
+
+  bool push(const NoteEvent &event) {
+    size_t currentIndex = writeIndex.load();
+    size_t nextIndex = (currentIndex + 1) & WRAP;
+
+    if (nextIndex == readIndex.load())
+      return false;
+
+    queue[currentIndex] = event;
+    writeIndex.store(nextIndex);
+
+    return true;
+  }
+
+  bool pop(NoteEvent &event) {
+    size_t currentIndex = readIndex.load();
+
+    if (currentIndex == writeIndex.load())
+      return false;
+
+    event = queue[currentIndex];
+    readIndex.store((currentIndex + 1) & WRAP);
+
+    return true;
+  }
+};
+
+using SpscQueue = synth_io::SpscQueue<NoteEvent, QUEUE_SIZE>;
+
+enum class PopMode { Single, Batch };
+
+// Busy-wait that still lets the other thread run on a single core
+void relax(uint32_t &spins) {
+  if (++spins % 64 == 0)
+    std::this_thread::yield();
+}
+
+// Consumer-side drain of everything currently queued
+size_t drain(LegacyQueue &queue, PopMode, NoteEvent *, uint64_t &checksum) {
+  size_t count = 0;
+  NoteEvent event;
+  while (queue.pop(event)) {
+    checksum += event.midiNote;
+    count++;
+  }
+  return count;
+}
+
+size_t drain(SpscQueue &queue, PopMode mode, NoteEvent *batch,
+             uint64_t &checksum) {
+  size_t count = 0;
+
+  if (mode == PopMode::Batch) {
+    count = queue.popBatch(batch, SpscQueue::CAPACITY);
+    for (size_t i = 0; i < count; i++)
+      checksum += batch[i].midiNote;
+    return count;
+  }
+
+  NoteEvent event;
+  while (queue.pop(event)) {
+    checksum += event.midiNote;
+    count++;
+  }
+  return count;
+}
+
+// Producer pushes a burst of _burstSize_ on its own thread and waits for
+// the consumer (this thread) to drain it before the next one.
+// Returns ns per event (end to end)
+template <typename Queue>
+double bench(uint64_t numEvents, uint32_t burstSize, PopMode mode,
+             uint64_t &checksum) {
+  auto *queue = new Queue{};
+  NoteEvent batch[QUEUE_SIZE];
+
+  std::atomic<bool> isReady{false};
+  std::atomic<uint64_t> poppedCount{0};
+
+  std::thread producer([&]() {
+    uint32_t spins = 0;
+    while (!isReady.load(std::memory_order_acquire))
+      relax(spins);
+
+    NoteEvent event{};
+    event.type = synth_io::NoteEventType::NoteOn;
+
+    uint64_t pushed = 0;
+    while (pushed < numEvents) {
+      for (uint32_t b = 0; b < burstSize && pushed < numEvents; b++) {
+        event.midiNote = static_cast<uint8_t>(pushed & 0x7F);
+        while (!queue->push(event))
+          relax(spins);
+        pushed++;
+      }
+
+      // Idle until the burst is consumed
+      while (poppedCount.load(std::memory_order_acquire) < pushed)
+        relax(spins);
+    }
+  });
+
+  Clock::time_point start = Clock::now();
+  isReady.store(true, std::memory_order_release);
+
+  uint64_t popped = 0;
+  uint32_t spins = 0;
+  while (popped < numEvents) {
+    size_t count = drain(*queue, mode, batch, checksum);
+    if (count) {
+      popped += count;
+      poppedCount.store(popped, std::memory_order_release);
+    } else {
+      relax(spins);
+    }
+  }
+
+  Clock::time_point end = Clock::now();
+  producer.join();
+  delete queue;
+
+  double elapsed = std::chrono::duration<double>(end - start).count();
+  return elapsed * 1e9 / static_cast<double>(numEvents);
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  uint64_t numEvents = 1000000;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--events") == 0 && i + 1 < argc) {
+      numEvents = std::strtoull(argv[++i], nullptr, 10);
+    } else {
+      printf("Usage: queue_bench [--events n]\n");
+      return 1;
+    }
+  }
+
+  const uint32_t BURST_SIZES[] = {1, 8, 64, 200};
+
+  printf("%-7s %10s %12s %12s %12s\n", "burst", "", "legacy", "spsc pop",
+         "spsc batch");
+
+  uint64_t checksum = 0; // keeps the optimizer honest
+  for (uint32_t burstSize : BURST_SIZES) {
+    double legacyNs =
+        bench<LegacyQueue>(numEvents, burstSize, PopMode::Single, checksum);
+    double spscNs =
+        bench<SpscQueue>(numEvents, burstSize, PopMode::Single, checksum);
+    double batchNs =
+        bench<SpscQueue>(numEvents, burstSize, PopMode::Batch, checksum);
+
+    printf("%-7u %10s %12.2f %12.2f %12.2f\n", burstSize, "ns/event",
+           legacyNs, spscNs, batchNs);
+    printf("%-7s %10s %12s %11.2fx %11.2fx\n", "", "speedup", "1.00x",
+           legacyNs / spscNs, legacyNs / batchNs);
+  }
+
+  printf("\n(checksum %llu)\n", static_cast<unsigned long long>(checksum));
+  return 0;
+}
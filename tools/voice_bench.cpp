@@ -0,0 +1,185 @@
+/* voice_bench.cpp
+ * Compares the voice render pipelines on the same workload:
+ *   per-sample  sample-outer, voice-inner (original ordering)
+ *   block       voice-outer, stage by stage over each ENGINE_BLOCK_SIZE block
+ *   lanes       groups of voices across SIMD lanes
+ *   compact     lanes on a compacted pool (contiguous loads, no gathers)
+ *   workers     block, with voices split across helper threads (--workers)
+ *
+ * Build:
+ *   make voicebench
+ *
+ * Usage:
+ *   ./voice_bench [--voices n] [--seconds n] [--width n] [--workers n]
+ *                 [--filters] [--interp-filters]
+ *
+ *   --voices <n>    sustained voices (default MAX_VOICES)
+ *   --seconds <n>   audio rendered per pipeline (default 10)
+ *   --width <n>     lane width 4/8/16 (default picked by the CPU check)
+ *   --workers <n>   helper threads for the workers run (default 0 = skip)
+ *   --filters       enable SVF + ladder, cutoffs swept by the filter
+ *                   envelope (default oscillators + amp only)
+ *   --interp-filters  ramp filter coefficients across each block
+ */
+
+#include "synth/Engine.h"
+#include "synth/VoiceLanes.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using VoiceRenderMode = synth::voices::VoiceRenderMode;
+
+struct BenchConfig {
+  uint32_t numVoices = synth::MAX_VOICES;
+  float seconds = 10.0f;
+  uint32_t laneWidth = 0;
+  uint32_t numWorkers = 0;
+  bool useFilters = false;
+  bool interpolateFilters = false;
+};
+
+struct BenchResult {
+  double elapsedSeconds = 0.0;
+  double nsPerVoiceSample = 0.0;
+  float checksum = 0.0f; // keeps the optimizer honest
+};
+
+BenchResult runBench(VoiceRenderMode mode, uint32_t numWorkers,
+                     bool compactVoices, const BenchConfig &config) {
+  synth::EngineConfig engineConfig{};
+  engineConfig.renderMode = mode;
+  engineConfig.laneWidth = config.laneWidth;
+  engineConfig.numWorkers = numWorkers;
+  engineConfig.compactVoices = compactVoices;
+  engineConfig.interpolateFilterCoeffs = config.interpolateFilters;
+  engineConfig.workerPolicy = synth::workers::WorkerPolicy::Spin;
+  engineConfig.osc1.waveform = synth::WaveformType::Saw;
+  engineConfig.osc2 = {synth::WaveformType::Square, 0.5f, -1, -10.0f, true};
+  engineConfig.osc3 = {synth::WaveformType::Triangle, 0.5f, 1, 7.0f, true};
+
+  // Engine is large (SoA arrays for every voice), keep it off the stack
+  auto *engine = new synth::Engine(synth::createEngine(engineConfig));
+  engine->voicePool.svf.enabled = config.useFilters;
+  engine->voicePool.ladder.enabled = config.useFilters;
+
+  // Modulated cutoffs: new filter coefficients for every voice every block
+  if (config.useFilters) {
+    using namespace synth::mod_matrix;
+    addRoute(engine->voicePool.modMatrix, ModSrc::FilterEnv,
+             ModDest::SVFCutoff, 3.0f);
+    addRoute(engine->voicePool.modMatrix, ModSrc::FilterEnv,
+             ModDest::LadderCutoff, 2.0f);
+  }
+
+  for (uint32_t v = 0; v < config.numVoices; v++) {
+    synth::NoteEvent noteOn{synth_io::NoteEventType::NoteOn,
+                            static_cast<uint8_t>(24 + v % 96), 100};
+    engine->processNoteEvent(noteOn);
+  }
+
+  // Blocks of the size the engine's buffers were created for
+  uint32_t numFrames = engineConfig.numFrames;
+  std::vector<float> buffer(numFrames);
+  float *channels[1] = {buffer.data()};
+
+  uint64_t numBlocks = static_cast<uint64_t>(
+      config.seconds * engine->sampleRate / static_cast<float>(numFrames));
+
+  BenchResult result{};
+
+  Clock::time_point start = Clock::now();
+  for (uint64_t b = 0; b < numBlocks; b++) {
+    engine->processAudioBlock(channels, 1, numFrames);
+    result.checksum += buffer[b % numFrames];
+  }
+  Clock::time_point end = Clock::now();
+
+  result.elapsedSeconds = std::chrono::duration<double>(end - start).count();
+
+  double voiceSamples = static_cast<double>(numBlocks) * numFrames *
+                        static_cast<double>(config.numVoices);
+  result.nsPerVoiceSample =
+      voiceSamples > 0.0 ? result.elapsedSeconds * 1e9 / voiceSamples : 0.0;
+
+  synth::disposeEngine(*engine);
+  delete engine;
+  return result;
+}
+
+void printResult(const char *name, const BenchResult &result,
+                 const BenchResult &baseline) {
+  printf("%-10s %10.3f %14.2f %9.2fx   (checksum %.4f)\n", name,
+         result.elapsedSeconds * 1e3, result.nsPerVoiceSample,
+         result.elapsedSeconds > 0.0
+             ? baseline.elapsedSeconds / result.elapsedSeconds
+             : 0.0,
+         static_cast<double>(result.checksum));
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  BenchConfig config{};
+
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+
+    if (strcmp(argv[i], "--voices") == 0 && hasValue) {
+      config.numVoices =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+      config.seconds = std::strtof(argv[++i], nullptr);
+    } else if (strcmp(argv[i], "--width") == 0 && hasValue) {
+      config.laneWidth =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--workers") == 0 && hasValue) {
+      config.numWorkers =
+          static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--filters") == 0) {
+      config.useFilters = true;
+    } else if (strcmp(argv[i], "--interp-filters") == 0) {
+      config.interpolateFilters = true;
+    } else {
+      printf("Usage: voice_bench [--voices n] [--seconds n] [--width n] "
+             "[--workers n] [--filters] [--interp-filters]\n");
+      return 1;
+    }
+  }
+
+  if (config.numVoices > synth::MAX_VOICES)
+    config.numVoices = synth::MAX_VOICES;
+
+  printf("%u voices, %.1fs of audio, filters %s, lane width %u\n\n",
+         config.numVoices, static_cast<double>(config.seconds),
+         !config.useFilters          ? "off"
+         : config.interpolateFilters ? "on (interpolated)"
+                                     : "on",
+         synth::voices::lanes::validateLaneWidth(config.laneWidth));
+  printf("%-10s %10s %14s %10s\n", "pipeline", "total ms", "ns/voice-smp",
+         "speedup");
+
+  BenchResult perSample =
+      runBench(VoiceRenderMode::PerSample, 0, false, config);
+  BenchResult block = runBench(VoiceRenderMode::Block, 0, false, config);
+  BenchResult lanes = runBench(VoiceRenderMode::Lanes, 0, false, config);
+  BenchResult compact = runBench(VoiceRenderMode::Lanes, 0, true, config);
+
+  printResult("per-sample", perSample, perSample);
+  printResult("block", block, perSample);
+  printResult("lanes", lanes, perSample);
+  printResult("compact", compact, perSample);
+
+  if (config.numWorkers) {
+    BenchResult threaded =
+        runBench(VoiceRenderMode::Block, config.numWorkers, false, config);
+    printResult("workers", threaded, perSample);
+  }
+
+  return 0;
+}